@@ -0,0 +1,180 @@
+// Canvas.h
+//
+// All the strips as one long row of pixels, for effects that should flow from
+// one strip into the next (a comet lapping the whole table, say).
+//
+// We only have RAM for one strip, so the canvas is never all there at once.
+// A Canvas is a window onto it: the pixels of the strip being rendered, at
+// their place in the whole. Programs draw in canvas coordinates (strip_nr *
+// pixels per strip + index), and anything outside the window is clipped, so
+// a program can draw the same thing for every strip and each strip picks out
+// its part. Canvas coordinates follow strip order, which for our layout is
+// also the order along the run (see layout.h).
+
+#pragma once
+
+#include "LedProgram.h"
+
+#include <Adafruit_DotStar.h>
+
+class Canvas
+{
+private:
+        Adafruit_DotStar& strip_;
+        const uint16_t first_;
+        const uint16_t end_;
+        const uint16_t size_;
+
+        // [from, to), which mustn't wrap
+        void fillClipped(uint16_t from, uint16_t to, const uint32_t color)
+        {
+                if (from < first_)
+                        from = first_;
+                if (to > end_)
+                        to = end_;
+                if (from >= to)
+                        return;
+                fillPixels(strip_, from - first_, to - first_, color);
+        }
+
+public:
+        Canvas(Adafruit_DotStar& strip, const uint8_t strip_nr,
+               const uint8_t nr_strips)
+                : strip_{strip},
+                  first_{(uint16_t)(strip_nr * strip.numPixels())},
+                  end_{(uint16_t)(first_ + strip.numPixels())},
+                  size_{(uint16_t)(nr_strips * strip.numPixels())}
+        {}
+
+        // pixels on the whole canvas
+        uint16_t size() const
+        {
+                return size_;
+        }
+
+        // the window: canvas coordinates [first(), end()) are on this strip
+        uint16_t first() const
+        {
+                return first_;
+        }
+
+        uint16_t end() const
+        {
+                return end_;
+        }
+
+        bool visible(const uint16_t i) const
+        {
+                return i >= first_ && i < end_;
+        }
+
+        // wrap a coordinate that may have run off either end of the canvas
+        uint16_t wrap(const int32_t i) const
+        {
+                int32_t w = i % size_;
+                return w < 0 ? w + size_ : w;
+        }
+
+        void set(const uint16_t i, const uint32_t color)
+        {
+                if (visible(i))
+                        strip_.setPixelColor(i - first_, color);
+        }
+
+        // count pixels starting at from, wrapping around the end of the
+        // canvas back to the start
+        void fill(uint16_t from, uint16_t count, const uint32_t color)
+        {
+                from = wrap(from);
+                if (count > size_)
+                        count = size_;
+
+                while (count != 0) {
+                        uint16_t n = size_ - from < count ? size_ - from : count;
+                        fillClipped(from, from + n, color);
+                        count -= n;
+                        from = 0;
+                }
+        }
+
+        void clear()
+        {
+                memset(strip_.getPixels(), 0, 3*strip_.numPixels());
+        }
+};
+
+// a program that draws on the canvas. The engine still calls updateStrip()
+// once per strip; this turns that into one step() per frame and one
+// render() per strip, on a window that's been cleared to black.
+class CanvasProg : public LedProgram
+{
+private:
+        const uint8_t nr_strips_;
+
+protected:
+        // work out where the animation is (see LedProgram::clock()) for
+        // anything every strip needs. Called once per frame, before strip 0
+        // is rendered.
+        virtual void step(const uint16_t brightness, const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+        }
+
+        // draw the frame. Called once per strip, so it has to draw the same
+        // thing every time; the canvas clips it to the strip.
+        virtual void render(Canvas& canvas, const uint16_t brightness,
+                            const uint16_t frequency) = 0;
+
+public:
+        CanvasProg(const uint8_t nr_strips) : nr_strips_{nr_strips} {}
+
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency) final
+        {
+                if (strip_nr == 0)
+                        step(brightness, frequency);
+
+                Canvas canvas{strip, strip_nr, nr_strips_};
+                canvas.clear();
+                render(canvas, brightness, frequency);
+        }
+};
+
+// a comet going round and round the whole canvas, with a fading tail
+class CometProg : public CanvasProg
+{
+private:
+        static constexpr uint8_t TAIL_ = 48;
+
+protected:
+        void render(Canvas& canvas, const uint16_t brightness,
+                    const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                // the head moves 1 + 6/256 frequency pixels a frame, i.e. 24
+                // at full frequency. That's travelled(256, 6) in 1/256ths of
+                // a pixel, but the canvas isn't a power of two long, so take
+                // it round the canvas a term at a time, before it can wrap.
+                const uint32_t n = (uint32_t)canvas.size() << 8;
+                const uint32_t head_256 = (256*(clock().frame % n)
+                                           + 6*(clock().freq_sum % n)) % n;
+
+                const uint16_t head = head_256 >> 8;
+                for (uint8_t k = 0; k < TAIL_; ++k) {
+                        uint16_t i = canvas.wrap((int32_t)head - k);
+                        if (!canvas.visible(i))
+                                continue;
+
+                        uint8_t v = gc_table[255 - k*(256/TAIL_)];
+                        canvas.set(i, Adafruit_DotStar::Color(v, v/2, v/8));
+                }
+        }
+
+public:
+        CometProg(const uint8_t nr_strips) : CanvasProg{nr_strips} {}
+};
@@ -0,0 +1,148 @@
+// CompositeProg.h
+//
+// A program made of two other programs, one drawn over the other, e.g.
+// sparkles over warm white.
+//
+// The base layer draws straight into the strip and the overlay into a buffer
+// of its own, which is then blended over the strip in place, so a composite
+// costs one strip of RAM. Each layer and the blend are StageProfiler stages
+// of their own, counted by the pixel, so "profile" on the console gives what
+// each costs per pixel.
+
+#pragma once
+
+#include "LedProgram.h"
+#include "StageProfiler.h"
+
+#include <Adafruit_DotStar.h>
+
+class CompositeProg : public LedProgram
+{
+public:
+        enum BlendMode {
+                // base + overlay, clamped
+                ADD,
+                // 1 - (1 - base)(1 - overlay): like ADD but never clips
+                SCREEN,
+                // base * overlay: the overlay works like a mask
+                MULTIPLY,
+                // base faded towards overlay by a fixed alpha
+                ALPHA
+        };
+
+private:
+        LedProgram& base_;
+        LedProgram& overlay_;
+        const BlendMode mode_;
+        const uint8_t alpha_;
+
+        // 0: both layers, 1: the base alone, which skips both the overlay's
+        // render and the blend
+        static constexpr uint8_t NR_QUALITY_LEVELS_ = 2;
+        uint8_t quality_ = 0;
+
+        // the overlay's buffer, which is never show()n. It has to be its own
+        // because programs are allowed to render strip 0 and then rely on
+        // the buffer still holding it for the other strips (see
+        // LedProgram::updateStrip()). That's a strip worth of RAM, so don't
+        // go wild with these.
+        Adafruit_DotStar overlay_strip_;
+
+        // x/255 for x in [0, 255*255], without a division
+        static uint8_t div255(const uint16_t x)
+        {
+                return (x + 1 + (x >> 8)) >> 8;
+        }
+
+        // blend the overlay buffer over the base layer in out, a byte at a
+        // time. Both are in the same color order and every mode treats the
+        // channels the same, so we don't care which byte is which.
+        void blend(uint8_t *out, const uint8_t *over, const uint16_t nr_bytes)
+        {
+                uint16_t i;
+
+                switch (mode_) {
+                case ADD:
+                        for (i = 0; i < nr_bytes; ++i) {
+                                uint16_t sum = out[i] + over[i];
+                                out[i] = sum > 255 ? 255 : sum;
+                        }
+                        break;
+
+                case SCREEN:
+                        for (i = 0; i < nr_bytes; ++i)
+                                out[i] = 255 - div255((uint16_t)(255 - out[i])
+                                                      * (255 - over[i]));
+                        break;
+
+                case MULTIPLY:
+                        for (i = 0; i < nr_bytes; ++i)
+                                out[i] = div255((uint16_t)out[i] * over[i]);
+                        break;
+
+                case ALPHA:
+                default:
+                        for (i = 0; i < nr_bytes; ++i)
+                                out[i] = div255((uint16_t)out[i] * (255 - alpha_)
+                                                + (uint16_t)over[i] * alpha_);
+                        break;
+                }
+        }
+
+public:
+        // nr_pixels and color_order must match the strip we'll be rendering
+        // into. alpha is only used for ALPHA.
+        CompositeProg(LedProgram& base, LedProgram& overlay,
+                      const BlendMode mode, const uint16_t nr_pixels,
+                      const uint8_t color_order, const uint8_t alpha = 128)
+                : base_{base}, overlay_{overlay}, mode_{mode}, alpha_{alpha},
+                  overlay_strip_{nr_pixels, color_order}
+        {}
+
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                const uint16_t n = strip.numPixels();
+                {
+                        ProfileStage stage{StageProfiler::BASE};
+                        // the strip still holds the last strip's blend, so
+                        // a base that re-uses strip 0 has to draw it again
+                        if (strip_nr != 0 && base_.reusesFirstStrip())
+                                base_.updateStrip(strip, 0, brightness, frequency);
+                        base_.updateStrip(strip, strip_nr, brightness, frequency);
+                        StageProfiler::count(StageProfiler::BASE, n);
+                }
+
+                if (quality_ >= 1)
+                        return;
+
+                {
+                        ProfileStage stage{StageProfiler::OVERLAY};
+                        overlay_.updateStrip(overlay_strip_, strip_nr,
+                                             brightness, frequency);
+                        StageProfiler::count(StageProfiler::OVERLAY, n);
+                }
+
+                ProfileStage stage{StageProfiler::BLEND};
+                blend(strip.getPixels(), overlay_strip_.getPixels(), 3*n);
+                StageProfiler::count(StageProfiler::BLEND, n);
+        }
+
+        uint8_t nrQualityLevels() const
+        {
+                return NR_QUALITY_LEVELS_;
+        }
+
+        void setQuality(const uint8_t level)
+        {
+                quality_ = level;
+        }
+
+        void activate()
+        {
+                base_.activate();
+                overlay_.activate();
+        }
+};
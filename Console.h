@@ -0,0 +1,111 @@
+// Console.h
+//
+// Non-blocking serial console. Commands come in as lines of text; replies go
+// out through a ring buffer that we drain only as fast as the serial port
+// will take it without blocking. Each poll() does a bounded amount of work,
+// so the console can run in loop()'s slack time without ever stalling a
+// frame. If the ring fills up, output is dropped (and counted) rather than
+// waited on.
+//
+// Console is a Print, so anything that prints can print to it.
+
+#pragma once
+
+#include <Arduino.h>
+
+class Console : public Print
+{
+private:
+        static constexpr uint8_t LINE_SIZE_ = 48;
+        static constexpr uint16_t TX_SIZE_ = 256;
+
+        // upper bound on input characters handled per poll()
+        static constexpr uint8_t MAX_RX_PER_POLL_ = 16;
+
+        Stream& stream_;
+
+        char line_[LINE_SIZE_];
+        uint8_t line_len_ = 0;
+        bool line_overflowed_ = false;
+
+        uint8_t tx_[TX_SIZE_];
+        uint16_t tx_head_ = 0;
+        uint16_t tx_tail_ = 0;
+        uint32_t tx_dropped_ = 0;
+
+        uint16_t txUsed() const
+        {
+                return (tx_head_ - tx_tail_ + TX_SIZE_) % TX_SIZE_;
+        }
+
+        void drain()
+        {
+                int room = stream_.availableForWrite();
+                while (room-- > 0 && tx_tail_ != tx_head_) {
+                        stream_.write(tx_[tx_tail_]);
+                        tx_tail_ = (tx_tail_ + 1) % TX_SIZE_;
+                }
+        }
+
+public:
+        Console(Stream& stream) : stream_{stream} {}
+
+        size_t write(uint8_t c)
+        {
+                // one slot is always left empty, to tell full from empty
+                if (txUsed() == TX_SIZE_ - 1) {
+                        ++tx_dropped_;
+                        return 0;
+                }
+
+                tx_[tx_head_] = c;
+                tx_head_ = (tx_head_ + 1) % TX_SIZE_;
+                return 1;
+        }
+
+        using Print::write;
+
+        // push out what we can and read what's there. Returns a complete
+        // command line (without the line ending) once there is one, which
+        // stays valid until the next poll(), else NULL.
+        char *poll()
+        {
+                drain();
+
+                for (uint8_t n = 0; n < MAX_RX_PER_POLL_; ++n) {
+                        int c = stream_.read();
+                        if (c < 0)
+                                break;
+
+                        if (c == '\r' || c == '\n') {
+                                bool overflowed = line_overflowed_;
+                                uint8_t len = line_len_;
+                                line_len_ = 0;
+                                line_overflowed_ = false;
+
+                                if (overflowed) {
+                                        println(F("line too long"));
+                                        continue;
+                                }
+                                if (len == 0)
+                                        continue;
+
+                                line_[len] = '\0';
+                                return line_;
+                        }
+
+                        if (line_len_ < LINE_SIZE_ - 1)
+                                line_[line_len_++] = c;
+                        else
+                                line_overflowed_ = true;
+                }
+
+                return NULL;
+        }
+
+        // bytes of output thrown away because the ring was full
+        uint32_t txDropped() const
+        {
+                return tx_dropped_;
+        }
+};
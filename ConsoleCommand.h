@@ -0,0 +1,116 @@
+// ConsoleCommand.h
+//
+// Parses the command lines Console::poll() returns into what to do, without
+// doing any of it: the sketch's handleCommand() acts on the result. Kept
+// apart from the sketch so the parsing can be tested on a computer, see
+// test/console_test.cpp.
+//
+// A line is a command word and at most one argument, separated by spaces.
+// Numeric arguments are decimal in [0, max], where max comes from the
+// sketch; "auto" (or "pot") means no override.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+struct ConsoleCommand
+{
+        enum Id : uint8_t {
+                // a blank line, or only spaces
+                NONE,
+                HELP,
+                GET,
+                PROG,
+                FREQ,
+                BRIGHTNESS,
+                STATS,
+                PROFILE,
+                PROFILE_RESET,
+                RAM,
+                TELEMETRY,
+                UNKNOWN
+        };
+
+        // the value of an "auto" argument
+        static constexpr int16_t AUTO = -1;
+
+        // the largest argument each command takes
+        struct Limits
+        {
+                int16_t prog;
+                int16_t freq;
+                int16_t brightness;
+                int16_t telemetry;
+        };
+
+        Id id;
+
+        // false if the command's argument was missing or out of range
+        bool ok;
+
+        // the argument, or AUTO
+        int16_t value;
+
+        // parse an argument in [0, max], or "auto" (or "pot")
+        static bool parseArg(const char *arg, const int16_t max, int16_t& value)
+        {
+                if (!arg)
+                        return false;
+
+                if (!strcmp(arg, "auto") || !strcmp(arg, "pot")) {
+                        value = AUTO;
+                        return true;
+                }
+
+                char *end;
+                long v = strtol(arg, &end, 10);
+                if (*end != '\0' || end == arg || v < 0 || v > max)
+                        return false;
+
+                value = v;
+                return true;
+        }
+
+        // parse a line from Console::poll(). This cuts the line up with
+        // strtok(), so the line isn't usable afterwards.
+        static ConsoleCommand parse(char *line, const Limits& limits)
+        {
+                const char *cmd = strtok(line, " ");
+                const char *arg = strtok(NULL, " ");
+                ConsoleCommand c{UNKNOWN, true, AUTO};
+
+                if (!cmd) {
+                        c.id = NONE;
+                } else if (!strcmp(cmd, "help")) {
+                        c.id = HELP;
+                } else if (!strcmp(cmd, "get")) {
+                        c.id = GET;
+                } else if (!strcmp(cmd, "prog")) {
+                        c.id = PROG;
+                        c.ok = parseArg(arg, limits.prog, c.value);
+                } else if (!strcmp(cmd, "freq")) {
+                        c.id = FREQ;
+                        c.ok = parseArg(arg, limits.freq, c.value);
+                } else if (!strcmp(cmd, "brightness")) {
+                        c.id = BRIGHTNESS;
+                        c.ok = parseArg(arg, limits.brightness, c.value);
+                } else if (!strcmp(cmd, "stats")) {
+                        c.id = STATS;
+                } else if (!strcmp(cmd, "profile")) {
+                        c.id = arg && !strcmp(arg, "reset") ? PROFILE_RESET
+                                : PROFILE;
+                } else if (!strcmp(cmd, "ram")) {
+                        c.id = RAM;
+                } else if (!strcmp(cmd, "telemetry")) {
+                        // a level, there's no "auto" telemetry
+                        c.id = TELEMETRY;
+                        c.ok = parseArg(arg, limits.telemetry, c.value)
+                                && c.value != AUTO;
+                }
+
+                return c;
+        }
+};
@@ -0,0 +1,373 @@
+// DmxReceiver.h
+//
+// Receiver for E1.31 (sACN) and Art-Net DMX data, so a lighting desk can
+// drive the strips directly instead of one of the built-in programs.
+//
+// The Mega has no network interface of its own, and we can't just add an
+// ethernet shield because its SPI pins (50-53) are LED strip pins. Instead a
+// small network bridge (an ESP8266 or similar) listens on the sACN and
+// Art-Net UDP ports and forwards each datagram, unchanged, over a serial
+// port using SLIP framing (RFC 1055). This class un-SLIPs those datagrams,
+// parses them, and writes the pixel data of every universe listed in the
+// universe map straight into the strip buffer before handing it to an
+// LedOutput.
+//
+// The strip buffer is shared with every other strip, so whatever a packet
+// doesn't cover is stale and is blacked out. That's no good for a strip that
+// is split between universes, where each packet only has part of it: those
+// strips need a shadow copy to keep the other universes' pixels in, 3 bytes
+// per pixel each, which the sketch hands us. test/dmx_test.cpp feeds this
+// E1.31 and Art-Net packets on a computer.
+
+#pragma once
+
+#include "LedOutput.h"
+#include "LiveInput.h"
+
+#include <Adafruit_DotStar.h>
+
+// where a universe's pixels go. Universes are numbered the sACN way, from 1;
+// Art-Net numbers its port-addresses from 0, so Art-Net 0 (net 0, subnet 0,
+// universe 0) is universe 1 here, which is how most desks patch the two
+// protocols against each other. DMX slots are taken as RGB triples starting
+// at pixel first_pixel of strip strip_nr; slots past the end of the strip
+// are ignored. 144 RGB pixels fit in one 512 slot universe, so usually this
+// is just one universe per strip starting at pixel 0. A strip with more than
+// one universe is split, see DmxReceiver.
+struct UniverseMapping
+{
+        uint16_t universe;
+        uint8_t strip_nr;
+        uint16_t first_pixel;
+};
+
+class DmxReceiver : public LiveInput
+{
+private:
+        // SLIP framing bytes
+        static constexpr uint8_t SLIP_END_ = 0xc0;
+        static constexpr uint8_t SLIP_ESC_ = 0xdb;
+        static constexpr uint8_t SLIP_ESC_END_ = 0xdc;
+        static constexpr uint8_t SLIP_ESC_ESC_ = 0xdd;
+
+        // an E1.31 data packet with a full universe is the biggest thing we
+        // need to hold: 126 bytes of headers plus 512 slots.
+        static constexpr uint16_t MAX_PACKET_ = 126 + 512;
+
+        // offsets into an E1.31 data packet
+        static constexpr uint16_t E131_ROOT_VECTOR_ = 18;
+        static constexpr uint16_t E131_FRAMING_VECTOR_ = 40;
+        static constexpr uint16_t E131_OPTIONS_ = 112;
+        static constexpr uint16_t E131_UNIVERSE_ = 113;
+        static constexpr uint16_t E131_DMP_VECTOR_ = 117;
+        static constexpr uint16_t E131_PROP_COUNT_ = 123;
+        static constexpr uint16_t E131_START_CODE_ = 125;
+        static constexpr uint16_t E131_DATA_ = 126;
+        static constexpr uint8_t E131_OPT_PREVIEW_ = 1 << 7;
+        static constexpr uint16_t E131_MAX_UNIVERSE_ = 63999;
+
+        // offsets into an Art-Net ArtDmx packet
+        static constexpr uint16_t ARTNET_OPCODE_ = 8;
+        static constexpr uint16_t ARTNET_PROT_VER_ = 10;
+        static constexpr uint16_t ARTNET_SUBUNI_ = 14;
+        static constexpr uint16_t ARTNET_NET_ = 15;
+        static constexpr uint16_t ARTNET_LENGTH_ = 16;
+        static constexpr uint16_t ARTNET_DATA_ = 18;
+        static constexpr uint16_t ARTNET_OP_DMX_ = 0x5000;
+
+        // upper bound on how much serial input one call to poll() will eat,
+        // so that a flood of data can't stall loop()
+        static constexpr uint16_t MAX_BYTES_PER_POLL_ = 128;
+
+        Stream& stream_;
+        const UniverseMapping *const map_;
+        const uint8_t map_size_;
+        const uint8_t nr_strips_;
+        uint8_t *const shadow_;
+        const uint16_t shadow_size_;
+
+        uint8_t packet_[MAX_PACKET_];
+        uint16_t packet_len_ = 0;
+        bool escaped_ = false;
+        bool overflowed_ = false;
+        unsigned long arrival_micros_ = 0;
+
+        bool ever_shown_ = false;
+        unsigned long last_packet_micros_ = 0;
+
+        // stats
+        uint32_t packets_ = 0;
+        uint32_t bad_ = 0;
+        uint32_t ignored_ = 0;
+        uint32_t unmapped_ = 0;
+        uint32_t min_interval_ = 0xffffffff;
+        uint32_t max_interval_ = 0;
+
+        uint16_t read16(const uint16_t offset) const
+        {
+                return (uint16_t)packet_[offset] << 8 | packet_[offset + 1];
+        }
+
+        bool matches(const char *id, const uint16_t len) const
+        {
+                return packet_len_ >= len && memcmp(packet_, id, len) == 0;
+        }
+
+        const UniverseMapping *lookup(const uint16_t universe) const
+        {
+                for (uint8_t i = 0; i < map_size_; ++i)
+                        if (map_[i].universe == universe)
+                                return &map_[i];
+                return NULL;
+        }
+
+        // the shadow copy of a split strip, or NULL if strip_nr isn't split
+        // or there's no room left for it. Split strips get shadow_ a strip at
+        // a time, in the order they first turn up in the map.
+        uint8_t *shadowFor(const uint8_t strip_nr, const uint16_t nr_bytes) const
+        {
+                uint8_t slot = 0;
+                for (uint8_t i = 0; i < map_size_; ++i) {
+                        bool seen = false;
+                        bool split = false;
+                        for (uint8_t j = 0; j < map_size_; ++j) {
+                                if (j == i || map_[j].strip_nr != map_[i].strip_nr)
+                                        continue;
+                                seen |= j < i;
+                                split = true;
+                        }
+                        if (seen || !split)
+                                continue;
+
+                        if (map_[i].strip_nr == strip_nr)
+                                return (uint32_t)(slot + 1)*nr_bytes <= shadow_size_
+                                        ? shadow_ + slot*nr_bytes : NULL;
+                        ++slot;
+                }
+                return NULL;
+        }
+
+        // figure out which universe this packet is for and where its slots
+        // are. Returns false if it isn't DMX data we understand.
+        bool parse(uint16_t& universe, const uint8_t *& slots,
+                   uint16_t& nr_slots)
+        {
+                static const char artnet_id[] = "Art-Net";
+                static const char e131_id[] = "\x00\x10\x00\x00" "ASC-E1.17";
+
+                // note the sizeofs include the terminating NULs, which are
+                // part of both ids
+                if (matches(artnet_id, sizeof artnet_id)) {
+                        if (packet_len_ < ARTNET_DATA_)
+                                return false;
+
+                        // the opcode is little endian, everything else big
+                        uint16_t opcode = packet_[ARTNET_OPCODE_]
+                                | (uint16_t)packet_[ARTNET_OPCODE_ + 1] << 8;
+                        if (opcode != ARTNET_OP_DMX_ || read16(ARTNET_PROT_VER_) < 14)
+                                return false;
+
+                        // a 15 bit port-address from 0, where sACN counts
+                        // universes from 1, so the same desk patch lands on
+                        // the same map entry either way
+                        universe = ((uint16_t)(packet_[ARTNET_NET_] & 0x7f) << 8
+                                    | packet_[ARTNET_SUBUNI_]) + 1;
+                        slots = packet_ + ARTNET_DATA_;
+                        nr_slots = read16(ARTNET_LENGTH_);
+                        return nr_slots <= packet_len_ - ARTNET_DATA_;
+                }
+
+                if (matches(e131_id, sizeof e131_id)) {
+                        if (packet_len_ < E131_DATA_)
+                                return false;
+
+                        // VECTOR_ROOT_E131_DATA, VECTOR_E131_DATA_PACKET and
+                        // VECTOR_DMP_SET_PROPERTY. Anything else (e.g. sync or
+                        // discovery packets) isn't pixel data.
+                        if (read16(E131_ROOT_VECTOR_) != 0 || read16(E131_ROOT_VECTOR_ + 2) != 4
+                            || read16(E131_FRAMING_VECTOR_) != 0 || read16(E131_FRAMING_VECTOR_ + 2) != 2
+                            || packet_[E131_DMP_VECTOR_] != 2)
+                                return false;
+
+                        // preview data is for visualizers, not for real lights.
+                        // Only the null start code carries dimmer levels.
+                        if (packet_[E131_OPTIONS_] & E131_OPT_PREVIEW_
+                            || packet_[E131_START_CODE_] != 0)
+                                return false;
+
+                        // the property count includes the start code
+                        uint16_t count = read16(E131_PROP_COUNT_);
+                        if (count == 0)
+                                return false;
+
+                        // 0, and everything past E131_MAX_UNIVERSE_, is
+                        // reserved
+                        universe = read16(E131_UNIVERSE_);
+                        if (universe == 0 || universe > E131_MAX_UNIVERSE_)
+                                return false;
+                        slots = packet_ + E131_DATA_;
+                        nr_slots = count - 1;
+                        return nr_slots <= packet_len_ - E131_DATA_;
+                }
+
+                return false;
+        }
+
+        // handle one complete datagram. Returns true if it was shown on a strip
+        bool handlePacket(Adafruit_DotStar& strip, LedOutput& output)
+        {
+                uint16_t universe;
+                const uint8_t *slots;
+                uint16_t nr_slots;
+
+                if (!parse(universe, slots, nr_slots)) {
+                        ++ignored_;
+                        return false;
+                }
+
+                // a map entry for a strip we haven't got counts as
+                // unmapped too
+                const UniverseMapping *m = lookup(universe);
+                if (!m || m->strip_nr >= nr_strips_) {
+                        ++unmapped_;
+                        return false;
+                }
+
+                unsigned long now_micros = micros();
+                if (ever_shown_) {
+                        uint32_t interval = now_micros - last_packet_micros_;
+                        if (interval < min_interval_)
+                                min_interval_ = interval;
+                        if (interval > max_interval_)
+                                max_interval_ = interval;
+                }
+                last_packet_micros_ = now_micros;
+                ever_shown_ = true;
+                ++packets_;
+
+                // start from the other universes' pixels if the strip is
+                // split, and black otherwise rather than show another
+                // strip's pixels
+                const uint16_t nr_bytes = 3*strip.numPixels();
+                uint8_t *shadow = shadowFor(m->strip_nr, nr_bytes);
+                if (shadow)
+                        memcpy(strip.getPixels(), shadow, nr_bytes);
+                else
+                        memset(strip.getPixels(), 0, nr_bytes);
+
+                uint16_t pixel = m->first_pixel;
+                for (uint16_t i = 0; i + 2 < nr_slots && pixel < strip.numPixels();
+                     i += 3, ++pixel)
+                        strip.setPixelColor(pixel, slots[i], slots[i + 1], slots[i + 2]);
+
+                if (shadow)
+                        memcpy(shadow, strip.getPixels(), nr_bytes);
+
+                output.show(strip, m->strip_nr);
+                shown(m->strip_nr, arrival_micros_);
+                return true;
+        }
+
+public:
+        // shadow is shadow_size bytes of room for the split strips' shadow
+        // copies, and can be NULL if the map doesn't split any strips
+        DmxReceiver(Stream& stream, const UniverseMapping *map,
+                    const uint8_t map_size, const uint8_t nr_strips,
+                    uint8_t *shadow = NULL, const uint16_t shadow_size = 0)
+                : stream_{stream}, map_{map}, map_size_{map_size},
+                  nr_strips_{nr_strips}, shadow_{shadow}, shadow_size_{shadow_size}
+        {
+                if (shadow_)
+                        memset(shadow_, 0, shadow_size_);
+        }
+
+        // eat whatever serial input is waiting (up to a bound) and show any
+        // complete packets
+        bool poll(Adafruit_DotStar& strip, LedOutput& output)
+        {
+                bool any_shown = false;
+
+                for (uint16_t n = 0; n < MAX_BYTES_PER_POLL_; ++n) {
+                        int c = stream_.read();
+                        if (c < 0)
+                                break;
+
+                        if (c == SLIP_END_) {
+                                if (overflowed_)
+                                        ++bad_;
+                                else if (packet_len_ != 0)
+                                        any_shown |= handlePacket(strip, output);
+
+                                packet_len_ = 0;
+                                escaped_ = false;
+                                overflowed_ = false;
+                                continue;
+                        }
+
+                        if (c == SLIP_ESC_) {
+                                escaped_ = true;
+                                continue;
+                        }
+
+                        if (escaped_) {
+                                c = c == SLIP_ESC_END_ ? SLIP_END_
+                                        : c == SLIP_ESC_ESC_ ? SLIP_ESC_ : c;
+                                escaped_ = false;
+                        }
+
+                        if (packet_len_ == 0)
+                                arrival_micros_ = micros();
+
+                        if (packet_len_ < MAX_PACKET_)
+                                packet_[packet_len_++] = c;
+                        else
+                                overflowed_ = true;
+                }
+
+                return any_shown;
+        }
+
+        // packets shown on a strip
+        uint32_t packets() const
+        {
+                return packets_;
+        }
+
+        // datagrams that overflowed our buffer
+        uint32_t bad() const
+        {
+                return bad_;
+        }
+
+        // datagrams that weren't DMX data (e.g. ArtPoll, sACN discovery)
+        uint32_t ignored() const
+        {
+                return ignored_;
+        }
+
+        // DMX data for a universe that isn't in the map, or that the map
+        // puts on a strip we haven't got
+        uint32_t unmapped() const
+        {
+                return unmapped_;
+        }
+
+        // shortest and longest time between two shown packets, in micros.
+        // The difference is the arrival jitter.
+        uint32_t minInterval() const
+        {
+                return min_interval_;
+        }
+
+        uint32_t maxInterval() const
+        {
+                return max_interval_;
+        }
+
+        void resetStats()
+        {
+                packets_ = bad_ = ignored_ = unmapped_ = 0;
+                min_interval_ = 0xffffffff;
+                max_interval_ = 0;
+        }
+};
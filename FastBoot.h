@@ -0,0 +1,165 @@
+// FastBoot.h
+//
+// Getting the strips dark as soon as the board comes out of reset. APA102s
+// power up showing whatever their shift registers came up with, which can be
+// full brightness white on 1152 LEDs, and setup() doesn't run until after the
+// Arduino core and every global constructor have.
+//
+// FastBoot::blank() clocks one black frame into all the strips at once: every
+// strip gets the same bits, so the data pins all move together and the clock
+// pins all move together, one port write per port per edge. It runs from
+// .init3 (see led_monger.ino), i.e. before RAM is initialized, so it can only
+// use registers and constants. The pin masks are worked out at compile time
+// from the pin tables, with pinMasks(), into constexpr constants at
+// namespace scope: called as an argument, pinMasks() needn't be folded, and
+// would read the pin tables before they're in RAM.
+//
+// The time it takes is measured with Timer1 and left in a .noinit variable
+// for setup() to pick up. That's the time from when our code starts, not from
+// power on: the bootloader runs before us, and there's nothing we can do
+// about that from here.
+
+#pragma once
+
+#include <Arduino.h>
+
+// the bits a set of pins occupies on each of the ports the strip pins (38-53
+// on the Mega) are on
+struct PinMasks
+{
+        uint8_t b;
+        uint8_t d;
+        uint8_t g;
+        uint8_t l;
+};
+
+namespace fast_boot {
+
+// pin to port bit, for pins 38-53:
+//
+//   38: D7, 39-41: G2-G0, 42-49: L7-L0, 50-53: B3-B0
+constexpr uint8_t pinBit(const uint8_t pin, const char port)
+{
+        return pin == 38 ? (port == 'D' ? 1 << 7 : 0)
+                : pin >= 39 && pin <= 41 ? (port == 'G' ? 1 << (41 - pin) : 0)
+                : pin >= 42 && pin <= 49 ? (port == 'L' ? 1 << (49 - pin) : 0)
+                : pin >= 50 && pin <= 53 ? (port == 'B' ? 1 << (53 - pin) : 0)
+                : 0;
+}
+
+constexpr uint8_t portMask(const uint8_t *pins, const uint8_t n, const char port)
+{
+        return n == 0 ? 0 : pinBit(pins[n - 1], port) | portMask(pins, n - 1, port);
+}
+
+constexpr bool allStripPins(const uint8_t *pins, const uint8_t n)
+{
+        return n == 0 || (pins[n - 1] >= 38 && pins[n - 1] <= 53
+                          && allStripPins(pins, n - 1));
+}
+
+}
+
+constexpr PinMasks pinMasks(const uint8_t *pins, const uint8_t n)
+{
+        return {
+                fast_boot::portMask(pins, n, 'B'),
+                fast_boot::portMask(pins, n, 'D'),
+                fast_boot::portMask(pins, n, 'G'),
+                fast_boot::portMask(pins, n, 'L')
+        };
+}
+
+class FastBoot
+{
+private:
+        // Timer1 ticks at 16MHz / 64
+        static constexpr uint8_t MICROS_PER_TICK_ = 4;
+
+        static uint16_t dark_ticks_;
+
+        static void clockByte(const PinMasks& clk, const PinMasks& data,
+                              uint8_t b)
+        {
+                for (uint8_t i = 0; i < 8; ++i, b <<= 1) {
+                        if (b & 0x80) {
+                                PORTB |= data.b;
+                                PORTD |= data.d;
+                                PORTG |= data.g;
+                                PORTL |= data.l;
+                        } else {
+                                PORTB &= ~data.b;
+                                PORTD &= ~data.d;
+                                PORTG &= ~data.g;
+                                PORTL &= ~data.l;
+                        }
+
+                        PORTB |= clk.b;
+                        PORTD |= clk.d;
+                        PORTG |= clk.g;
+                        PORTL |= clk.l;
+
+                        PORTB &= ~clk.b;
+                        PORTD &= ~clk.d;
+                        PORTG &= ~clk.g;
+                        PORTL &= ~clk.l;
+                }
+        }
+
+public:
+        // only call this with interrupts off, i.e. from .init3: PORTL and
+        // PORTG writes aren't atomic. Never inlined, since the .init3
+        // hook can't have a stack frame of its own.
+        __attribute__((noinline))
+        static void blank(const PinMasks clk, const PinMasks data,
+                          const uint16_t nr_leds)
+        {
+                TCCR1A = 0;
+                TCNT1 = 0;
+                TCCR1B = _BV(CS11) | _BV(CS10);
+
+                PORTB &= ~(clk.b | data.b);
+                PORTD &= ~(clk.d | data.d);
+                PORTG &= ~(clk.g | data.g);
+                PORTL &= ~(clk.l | data.l);
+                DDRB |= clk.b | data.b;
+                DDRD |= clk.d | data.d;
+                DDRG |= clk.g | data.g;
+                DDRL |= clk.l | data.l;
+
+                // the same frame the DotStar class sends, all black: a start
+                // frame, a header and three zero color bytes per LED, and
+                // an end frame
+                for (uint8_t i = 0; i < 4; ++i)
+                        clockByte(clk, data, 0);
+
+                for (uint16_t i = 0; i < nr_leds; ++i) {
+                        clockByte(clk, data, 0xff);
+                        clockByte(clk, data, 0);
+                        clockByte(clk, data, 0);
+                        clockByte(clk, data, 0);
+                }
+
+                for (uint16_t i = 0; i < (nr_leds + 15) / 16; ++i)
+                        clockByte(clk, data, 0xff);
+
+                PORTB &= ~data.b;
+                PORTD &= ~data.d;
+                PORTG &= ~data.g;
+                PORTL &= ~data.l;
+
+                // hand Timer1 back to the Arduino core as we found it
+                dark_ticks_ = TCNT1;
+                TCCR1B = 0;
+                TCNT1 = 0;
+        }
+
+        // how long blank() took
+        static unsigned long darkMicros()
+        {
+                return (unsigned long)dark_ticks_ * MICROS_PER_TICK_;
+        }
+};
+
+// .bss gets zeroed after .init3, which would wipe this out
+uint16_t FastBoot::dark_ticks_ __attribute__((section(".noinit")));
@@ -0,0 +1,316 @@
+// FrameSync.h
+//
+// Keeping several boards' frames in step, for when 8 strips aren't enough and
+// there's a Mega per group of tables. Left to themselves, each board's frame
+// clock runs off its own crystal and they drift apart, and so do the
+// animations.
+//
+// One board is the leader: at the start of every frame it sends a packet with
+// the frame number, the frequency summed over all frames so far, and the
+// program and inputs that frame is rendered from. The first two are the
+// animation clock (see LedProgram::clock()), so a follower that takes them
+// shows the same thing as the leader, however long ago either of them
+// switched to the program.
+// The leader's TX goes to the RX of every follower (one UART output can drive
+// a handful of inputs). Followers take the program and inputs from the
+// leader, and steer their frame clock to start each frame when the leader
+// does: a packet's arrival is taken as when the leader started that frame,
+// and a fraction of the difference is taken off each frame, so the phase
+// error dies away without any frame visibly jumping. Only a follower that is
+// way out (just booted, or the leader restarted) starts over at the leader's
+// frame.
+//
+// A packet is (multi-byte fields are big endian):
+//
+//   offset  size  field
+//   0       2     magic, 'F' 'S'
+//   2       4     frame number
+//   6       4     frequency sum
+//   10      1     program number
+//   11      2     frequency
+//   13      2     brightness
+//   15      1     checksum of bytes 0-14
+//
+// At 1Mbaud a packet takes 160us to send, which is well under the millisecond
+// the frame clock counts in, so we don't correct for it.
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace frame_sync {
+
+static constexpr uint8_t MAGIC_0 = 'F';
+static constexpr uint8_t MAGIC_1 = 'S';
+static constexpr uint8_t PACKET_SIZE = 16;
+
+static inline uint8_t checksum(const uint8_t *p, const uint8_t n)
+{
+        uint8_t sum = 0;
+        for (uint8_t i = 0; i < n; ++i)
+                sum = (sum << 1 | sum >> 7) ^ p[i];
+        return ~sum;
+}
+
+}
+
+// what the leader says about a frame
+struct SyncFrame
+{
+        uint32_t frame;
+        // the frequency summed over frames up to and including this one
+        uint32_t freq_sum;
+        uint8_t prog;
+        uint16_t freq;
+        uint16_t brightness;
+};
+
+class SyncLeader
+{
+private:
+        Stream& stream_;
+
+public:
+        SyncLeader(Stream& stream) : stream_{stream} {}
+
+        // call at the start of every frame
+        void frameStarted(const SyncFrame& f)
+        {
+                const uint8_t packet[frame_sync::PACKET_SIZE] = {
+                        frame_sync::MAGIC_0,
+                        frame_sync::MAGIC_1,
+                        (uint8_t)(f.frame >> 24),
+                        (uint8_t)(f.frame >> 16),
+                        (uint8_t)(f.frame >> 8),
+                        (uint8_t)f.frame,
+                        (uint8_t)(f.freq_sum >> 24),
+                        (uint8_t)(f.freq_sum >> 16),
+                        (uint8_t)(f.freq_sum >> 8),
+                        (uint8_t)f.freq_sum,
+                        f.prog,
+                        (uint8_t)(f.freq >> 8),
+                        (uint8_t)f.freq,
+                        (uint8_t)(f.brightness >> 8),
+                        (uint8_t)f.brightness,
+                        0
+                };
+
+                const uint8_t check = frame_sync::checksum(packet, sizeof packet - 1);
+                stream_.write(packet, sizeof packet - 1);
+                stream_.write(check);
+        }
+};
+
+class SyncFollower
+{
+private:
+        // no packets for this long and we're on our own again
+        static constexpr unsigned long TIMEOUT_MILLIS_ = 1000;
+
+        // upper bound on how much input one call to poll() will eat
+        static constexpr uint8_t MAX_BYTES_PER_POLL_ = 32;
+
+        // take 1/2^SLEW_SHIFT_ of the phase error off per frame, and never
+        // more than 1/2^SLEW_LIMIT_SHIFT_ of a frame, so frames stretch or
+        // shrink a little instead of jumping
+        static constexpr uint8_t SLEW_SHIFT_ = 2;
+        static constexpr uint8_t SLEW_LIMIT_SHIFT_ = 3;
+
+        // further out than this many frames and we start over at the
+        // leader's frame instead
+        static constexpr uint8_t MAX_SLEW_FRAMES_ = 2;
+
+        Stream& stream_;
+
+        uint8_t packet_[frame_sync::PACKET_SIZE];
+        uint8_t pos_ = 0;
+        unsigned long arrival_millis_ = 0;
+
+        SyncFrame leader_;
+        unsigned long leader_millis_ = 0;
+        bool have_leader_ = false;
+        bool fresh_ = false;
+
+        // stats
+        uint32_t packets_ = 0;
+        uint32_t bad_ = 0;
+        uint32_t restarts_ = 0;
+        long last_error_ = 0;
+        unsigned long max_error_ = 0;
+
+        static uint32_t read32(const uint8_t *p)
+        {
+                return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16
+                        | (uint32_t)p[2] << 8 | p[3];
+        }
+
+        static uint16_t read16(const uint8_t *p)
+        {
+                return (uint16_t)p[0] << 8 | p[1];
+        }
+
+        void finishPacket()
+        {
+                pos_ = 0;
+
+                const uint8_t n = frame_sync::PACKET_SIZE - 1;
+                if (packet_[n] != frame_sync::checksum(packet_, n)) {
+                        ++bad_;
+                        return;
+                }
+
+                leader_.frame = read32(packet_ + 2);
+                leader_.freq_sum = read32(packet_ + 6);
+                leader_.prog = packet_[10];
+                leader_.freq = read16(packet_ + 11);
+                leader_.brightness = read16(packet_ + 13);
+                leader_millis_ = arrival_millis_;
+                have_leader_ = true;
+                fresh_ = true;
+                ++packets_;
+        }
+
+public:
+        SyncFollower(Stream& stream) : stream_{stream} {}
+
+        void poll()
+        {
+                for (uint8_t n = 0; n < MAX_BYTES_PER_POLL_; ++n) {
+                        int c = stream_.read();
+                        if (c < 0)
+                                break;
+
+                        if (pos_ == 0)
+                                arrival_millis_ = millis();
+
+                        // hunt for the magic number. "FFS" is an 'F' too
+                        // many and then a packet.
+                        if (pos_ == 0 && c != frame_sync::MAGIC_0)
+                                continue;
+                        if (pos_ == 1 && c != frame_sync::MAGIC_1) {
+                                pos_ = c == frame_sync::MAGIC_0;
+                                arrival_millis_ = millis();
+                                continue;
+                        }
+
+                        packet_[pos_++] = c;
+                        if (pos_ == frame_sync::PACKET_SIZE)
+                                finishPacket();
+                }
+        }
+
+        // are we hearing from a leader?
+        bool locked(const unsigned long now) const
+        {
+                return have_leader_ && now - leader_millis_ <= TIMEOUT_MILLIS_;
+        }
+
+        // the leader's latest frame
+        const SyncFrame& leader() const
+        {
+                return leader_;
+        }
+
+        // the leader's frequency sum at frame number "frame", for frames a
+        // little either side of its latest, assuming the frequency stays
+        // put. If it doesn't, we're out by a frame's worth until the next
+        // packet.
+        uint32_t freqSumAt(const uint32_t frame) const
+        {
+                return leader_.freq_sum
+                        + (int32_t)(frame - leader_.frame)*(int32_t)leader_.freq;
+        }
+
+        // when the leader's latest frame started, on our clock
+        unsigned long leaderMillis() const
+        {
+                return leader_millis_;
+        }
+
+        // once per packet, compare our frame clock with the leader's: we
+        // started frame number "frame" at "frame_start", and frames are
+        // "interval" long. Returns how many millis to move our frame clock
+        // by (negative is earlier). Sets restart instead if we're too far
+        // out to slew, in which case we should just carry on from the
+        // leader's frame. Returns 0 if there's been no new packet.
+        long correction(const uint32_t frame, const unsigned long frame_start,
+                        const unsigned long interval, bool& restart)
+        {
+                restart = false;
+                if (!fresh_)
+                        return 0;
+                fresh_ = false;
+
+                // if we were in step, our frame would have started whole
+                // frames before or after the leader's. Positive error means
+                // we're behind.
+                // int32_t, not long, so that frame numbers either side of
+                // wrapping around come out a few frames apart on any
+                // width of long
+                const long frames = (int32_t)(leader_.frame - frame);
+                if (frames > MAX_SLEW_FRAMES_ || frames < -MAX_SLEW_FRAMES_) {
+                        ++restarts_;
+                        restart = true;
+                        return 0;
+                }
+
+                const long error = (long)(frame_start - leader_millis_)
+                        + frames*(long)interval;
+                const unsigned long abs_error = error < 0 ? -error : error;
+                if (abs_error > MAX_SLEW_FRAMES_*interval) {
+                        ++restarts_;
+                        restart = true;
+                        return 0;
+                }
+
+                // the error from getting in step in the first place isn't
+                // interesting, so this only counts once we're slewing
+                last_error_ = error;
+                if (abs_error > max_error_)
+                        max_error_ = abs_error;
+
+                const long limit = interval >> SLEW_LIMIT_SHIFT_;
+                long slew = -(error >> SLEW_SHIFT_);
+                if (slew > limit)
+                        slew = limit;
+                if (slew < -limit)
+                        slew = -limit;
+                return slew;
+        }
+
+        // valid packets
+        uint32_t packets() const
+        {
+                return packets_;
+        }
+
+        // packets with a bad checksum
+        uint32_t bad() const
+        {
+                return bad_;
+        }
+
+        // times we gave up slewing and started over at the leader's frame
+        uint32_t restarts() const
+        {
+                return restarts_;
+        }
+
+        // phase error as of the last packet and the worst we've seen, in
+        // millis. Positive means we're behind the leader.
+        long lastError() const
+        {
+                return last_error_;
+        }
+
+        unsigned long maxError() const
+        {
+                return max_error_;
+        }
+
+        void resetStats()
+        {
+                packets_ = bad_ = restarts_ = 0;
+                max_error_ = 0;
+        }
+};
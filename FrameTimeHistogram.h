@@ -0,0 +1,144 @@
+// FrameTimeHistogram.h
+//
+// Distribution of how long frames take, so runs can be compared by more than
+// their average.
+//
+// The buckets are a quarter of an octave of microseconds wide, i.e. each is
+// 19-25% wider than the one below, so a frame time that moves by 25% always
+// lands in another bucket, and the percentiles are interpolated within a
+// bucket rather than reported as its top. That's 84 buckets, 168 bytes.
+
+#pragma once
+
+#include <Arduino.h>
+
+class FrameTimeHistogram
+{
+private:
+        // below 4us each microsecond has a bucket of its own, and from there
+        // each octave [2^k, 2^(k+1)) gets SUB_BUCKETS_, up to 2^22us (4
+        // seconds, which had better be empty). The last bucket holds
+        // everything over that too.
+        static constexpr uint8_t SUB_BUCKETS_ = 4;
+        static constexpr uint8_t SUB_BITS_ = 2;
+        static constexpr uint8_t MAX_OCTAVE_ = 22;
+        static constexpr uint8_t NR_BUCKETS_ =
+                SUB_BUCKETS_ + (MAX_OCTAVE_ - SUB_BITS_)*SUB_BUCKETS_;
+
+        uint16_t buckets_[NR_BUCKETS_];
+        uint32_t count_ = 0;
+        uint32_t min_ = 0xffffffff;
+        uint32_t max_ = 0;
+        uint64_t total_ = 0;
+
+        static uint8_t bucket(const uint32_t micros)
+        {
+                if (micros < SUB_BUCKETS_)
+                        return micros;
+
+                uint8_t octave = SUB_BITS_;
+                while (micros >> (octave + 1) && octave < MAX_OCTAVE_)
+                        ++octave;
+                if (octave == MAX_OCTAVE_)
+                        return NR_BUCKETS_ - 1;
+
+                // the SUB_BITS_ bits below the top one pick the sub-bucket
+                const uint8_t sub = (micros >> (octave - SUB_BITS_)) & (SUB_BUCKETS_ - 1);
+                return SUB_BUCKETS_ + (octave - SUB_BITS_)*SUB_BUCKETS_ + sub;
+        }
+
+        // the smallest time that goes in bucket i
+        static uint32_t bucketStart(const uint8_t i)
+        {
+                if (i < SUB_BUCKETS_)
+                        return i;
+                const uint8_t octave = (i - SUB_BUCKETS_)/SUB_BUCKETS_ + SUB_BITS_;
+                const uint8_t sub = (i - SUB_BUCKETS_) % SUB_BUCKETS_;
+                return (uint32_t)(SUB_BUCKETS_ + sub) << (octave - SUB_BITS_);
+        }
+
+        // the p'th percentile, assuming the times in a bucket are spread
+        // evenly across it, and kept within what we've actually seen
+        uint32_t percentile(const uint8_t p) const
+        {
+                const uint64_t want = (uint64_t)count_ * p;
+                uint64_t seen = 0;
+                for (uint8_t i = 0; i < NR_BUCKETS_; ++i) {
+                        const uint64_t here = (uint64_t)buckets_[i] * 100;
+                        if (here == 0 || seen + here < want) {
+                                seen += here;
+                                continue;
+                        }
+
+                        const uint32_t start = bucketStart(i);
+                        const uint32_t end = i + 1 < NR_BUCKETS_
+                                ? bucketStart(i + 1) : max_ + 1;
+                        uint32_t t = start + (uint32_t)((end - start)
+                                                        * (want - seen) / here);
+                        if (t < min_)
+                                t = min_;
+                        if (t > max_)
+                                t = max_;
+                        return t;
+                }
+                return max_;
+        }
+
+public:
+        FrameTimeHistogram()
+        {
+                reset();
+        }
+
+        void reset()
+        {
+                memset(buckets_, 0, sizeof buckets_);
+                count_ = 0;
+                min_ = 0xffffffff;
+                max_ = 0;
+                total_ = 0;
+        }
+
+        void add(const uint32_t micros)
+        {
+                uint16_t& b = buckets_[bucket(micros)];
+                if (b != 0xffff)
+                        ++b;
+                ++count_;
+                total_ += micros;
+                if (micros < min_)
+                        min_ = micros;
+                if (micros > max_)
+                        max_ = micros;
+        }
+
+        void print(Print& out) const
+        {
+                if (count_ == 0) {
+                        out.println(F("frames=0"));
+                        return;
+                }
+
+                out.print(F("frames="));
+                out.print(count_);
+                out.print(F(" min_us="));
+                out.print(min_);
+                out.print(F(" mean_us="));
+                out.print((uint32_t)(total_ / count_));
+                out.print(F(" p50_us="));
+                out.print(percentile(50));
+                out.print(F(" p99_us="));
+                out.print(percentile(99));
+                out.print(F(" max_us="));
+                out.println(max_);
+
+                for (uint8_t i = 0; i < NR_BUCKETS_; ++i) {
+                        if (buckets_[i] == 0)
+                                continue;
+                        out.print(F("  "));
+                        out.print(bucketStart(i));
+                        out.print(F("us+: "));
+                        out.println(buckets_[i]);
+                }
+        }
+};
@@ -0,0 +1,95 @@
+// FrameTracker.h
+//
+// Keeps track of what was last latched into each LED strip so that loop()
+// can skip re-sending a strip whose contents haven't changed, and counts
+// repeated and dropped frames.
+
+#pragma once
+
+#include "PixelHash.h"
+
+#include <Arduino.h>
+
+template <uint8_t NrStrips>
+class FrameTracker
+{
+private:
+        // even if a strip hasn't changed we re-send it every so often, so a
+        // glitch on the clock or data line, or a hash collision, can't leave
+        // garbage on the strip for long. This is by time rather than by a
+        // count of skipped frames, since at the slowest frame rates 255
+        // skips was over four minutes.
+        static constexpr unsigned long REFRESH_MILLIS_ = 1000;
+
+        struct StripState {
+                uint32_t hash = 0;
+                unsigned long shown_at = 0;
+                uint8_t brightness = 0;
+                bool valid = false;
+        };
+
+        StripState strips_[NrStrips];
+
+        uint32_t shown_ = 0;
+        uint32_t repeated_ = 0;
+        uint32_t dropped_ = 0;
+
+public:
+        // should we call show() for this strip? Returns false if the strip is
+        // already displaying exactly these pixels at this brightness, and was
+        // last sent less than REFRESH_MILLIS_ before now (millis()).
+        bool needsShow(const uint8_t strip_nr, const uint8_t *pixels,
+                       const uint16_t nr_bytes, const uint8_t brightness,
+                       const unsigned long now)
+        {
+                StripState& s = strips_[strip_nr];
+                uint32_t hash = hashPixels(pixels, nr_bytes);
+
+                if (s.valid && s.hash == hash && s.brightness == brightness
+                    && now - s.shown_at < REFRESH_MILLIS_) {
+                        ++repeated_;
+                        return false;
+                }
+
+                s.hash = hash;
+                s.brightness = brightness;
+                s.shown_at = now;
+                s.valid = true;
+                ++shown_;
+                return true;
+        }
+
+        // forget what's on the strips, e.g. because something other than
+        // loop() wrote to them. The next frame will be sent in full.
+        void invalidate()
+        {
+                for (uint8_t i = 0; i < NrStrips; ++i)
+                        strips_[i].valid = false;
+        }
+
+        // call once per frame. There's only one thread of execution, so we
+        // can't drop a frame in the usual sense; instead, if a frame took
+        // longer than its interval we count every interval we blew through
+        // as a dropped frame, since that's an update the strips never saw.
+        void frameDone(const unsigned long frame_millis,
+                       const unsigned long interval_millis)
+        {
+                if (interval_millis != 0 && frame_millis > interval_millis)
+                        dropped_ += frame_millis / interval_millis;
+        }
+
+        uint32_t shown() const
+        {
+                return shown_;
+        }
+
+        uint32_t repeated() const
+        {
+                return repeated_;
+        }
+
+        uint32_t dropped() const
+        {
+                return dropped_;
+        }
+};
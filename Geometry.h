@@ -0,0 +1,267 @@
+// Geometry.h
+//
+// Where each pixel physically is, for programs that want to draw in space
+// rather than along a strip.
+//
+// A layout (see layout.h) describes the installation: how many strips, how
+// many LEDs on each, and for each strip a straight run between two points.
+// Geometry<Layout> turns that into a table in flash with an entry per pixel:
+// its position, its angle and distance from the layout's center, and how far
+// along the whole run (strip 0's first pixel to strip N's last) it is. The
+// table is worked out by the compiler, so a program asking for a pixel's
+// angle gets a flash read rather than an atan2(), which takes thousands of
+// cycles on the AVR.
+//
+// A different installation only needs a different layout; neither this nor
+// the programs change.
+
+#pragma once
+
+#include <Arduino.h>
+
+// a strip laid out in a straight line from (x0, y0) to (x1, y1), in mm.
+// Pixel 0 is at the (x0, y0) end.
+struct StripRun
+{
+        int16_t x0;
+        int16_t y0;
+        int16_t x1;
+        int16_t y1;
+};
+
+// where one pixel is
+struct PixelPlace
+{
+        // position in mm
+        int16_t x;
+        int16_t y;
+
+        // around the layout's center: the angle counterclockwise from +x,
+        // 65536 to the full turn, and the distance in mm
+        uint16_t angle;
+        uint16_t radius;
+
+        // along the run from the first pixel of strip 0, in mm
+        uint16_t distance;
+};
+
+namespace geometry {
+
+// the compiler works the table out in doubles, which never make it onto the
+// board
+
+constexpr double PI_ = 3.14159265358979;
+
+constexpr double absc(const double x)
+{
+        return x < 0 ? -x : x;
+}
+
+constexpr double sq(const double x)
+{
+        return x*x;
+}
+
+constexpr double sqrtIter(const double x, const double guess, const uint8_t n)
+{
+        return n == 0 ? guess : sqrtIter(x, (guess + x/guess)/2, n - 1);
+}
+
+constexpr double sqrtc(const double x)
+{
+        return x <= 0 ? 0 : sqrtIter(x, x > 1 ? x : 1, 40);
+}
+
+// atan() for |z| <= 1, good to about 0.0015 radians, a tenth of an 8 bit
+// angle step
+constexpr double atanUnit(const double z)
+{
+        return PI_/4*z - z*(absc(z) - 1)*(0.2447 + 0.0663*absc(z));
+}
+
+constexpr double atan2c(const double y, const double x)
+{
+        return x == 0 && y == 0 ? 0
+                : absc(x) >= absc(y)
+                ? atanUnit(y/x) + (x >= 0 ? 0 : y >= 0 ? PI_ : -PI_)
+                : (y >= 0 ? PI_/2 : -PI_/2) - atanUnit(x/y);
+}
+
+constexpr long roundc(const double x)
+{
+        return (long)(x + (x < 0 ? -0.5 : 0.5));
+}
+
+constexpr uint16_t turns(const double radians)
+{
+        return (uint16_t)((uint32_t)roundc((radians < 0 ? radians + 2*PI_ : radians)
+                                           / (2*PI_) * 65536) & 0xffff);
+}
+
+template <class Layout>
+constexpr double runLength(const uint8_t s)
+{
+        return sqrtc(sq(Layout::runs[s].x1 - Layout::runs[s].x0)
+                     + sq(Layout::runs[s].y1 - Layout::runs[s].y0));
+}
+
+template <class Layout>
+constexpr double runStart(const uint8_t s)
+{
+        return s == 0 ? 0 : runStart<Layout>(s - 1) + runLength<Layout>(s - 1);
+}
+
+// how far along its strip pixel i (counting across all strips) is, from 0 to
+// 1. Pixels sit in the middle of their share of the strip.
+template <class Layout>
+constexpr double along(const uint16_t i)
+{
+        return (i % Layout::leds_per_strip + 0.5) / Layout::leds_per_strip;
+}
+
+template <class Layout>
+constexpr double pixelX(const uint16_t i)
+{
+        return Layout::runs[i / Layout::leds_per_strip].x0
+                + (Layout::runs[i / Layout::leds_per_strip].x1
+                   - Layout::runs[i / Layout::leds_per_strip].x0) * along<Layout>(i);
+}
+
+template <class Layout>
+constexpr double pixelY(const uint16_t i)
+{
+        return Layout::runs[i / Layout::leds_per_strip].y0
+                + (Layout::runs[i / Layout::leds_per_strip].y1
+                   - Layout::runs[i / Layout::leds_per_strip].y0) * along<Layout>(i);
+}
+
+template <class Layout>
+constexpr PixelPlace placeOf(const uint16_t i)
+{
+        return {
+                (int16_t)roundc(pixelX<Layout>(i)),
+                (int16_t)roundc(pixelY<Layout>(i)),
+                turns(atan2c(pixelY<Layout>(i) - Layout::center_y,
+                             pixelX<Layout>(i) - Layout::center_x)),
+                (uint16_t)roundc(sqrtc(sq(pixelX<Layout>(i) - Layout::center_x)
+                                       + sq(pixelY<Layout>(i) - Layout::center_y))),
+                (uint16_t)roundc(runStart<Layout>(i / Layout::leds_per_strip)
+                                 + runLength<Layout>(i / Layout::leds_per_strip)
+                                 * along<Layout>(i))
+        };
+}
+
+// 0, 1, ..., N - 1 as a parameter pack, built by halves so that 1152 pixels
+// don't run into the compiler's template depth limit
+template <uint16_t... I>
+struct Indices {};
+
+template <class A, class B>
+struct Concat;
+
+template <uint16_t... A, uint16_t... B>
+struct Concat<Indices<A...>, Indices<B...>>
+{
+        using type = Indices<A..., (sizeof...(A) + B)...>;
+};
+
+template <uint16_t N>
+struct MakeIndices
+{
+        using type = typename Concat<typename MakeIndices<N/2>::type,
+                                     typename MakeIndices<N - N/2>::type>::type;
+};
+
+template <>
+struct MakeIndices<0>
+{
+        using type = Indices<>;
+};
+
+template <>
+struct MakeIndices<1>
+{
+        using type = Indices<0>;
+};
+
+template <class Layout, class Seq>
+struct PlaceTable;
+
+template <class Layout, uint16_t... I>
+struct PlaceTable<Layout, Indices<I...>>
+{
+        static const PixelPlace places[sizeof...(I)];
+};
+
+template <class Layout, uint16_t... I>
+const PixelPlace PlaceTable<Layout, Indices<I...>>::places[sizeof...(I)] PROGMEM = {
+        placeOf<Layout>(I)...
+};
+
+}
+
+template <class Layout>
+class Geometry
+{
+private:
+        using Table = geometry::PlaceTable<
+                Layout,
+                typename geometry::MakeIndices<Layout::nr_strips
+                                               * Layout::leds_per_strip>::type>;
+
+        static const PixelPlace *entry(const uint8_t strip_nr, const uint16_t i)
+        {
+                return &Table::places[(uint16_t)strip_nr*Layout::leds_per_strip + i];
+        }
+
+public:
+        static constexpr uint8_t nrStrips()
+        {
+                return Layout::nr_strips;
+        }
+
+        static constexpr uint16_t ledsPerStrip()
+        {
+                return Layout::leds_per_strip;
+        }
+
+        // from the start of strip 0 to the end of the last strip, in mm
+        static constexpr uint16_t runLength()
+        {
+                return geometry::roundc(geometry::runStart<Layout>(Layout::nr_strips));
+        }
+
+        static PixelPlace place(const uint8_t strip_nr, const uint16_t i)
+        {
+                PixelPlace p;
+                memcpy_P(&p, entry(strip_nr, i), sizeof p);
+                return p;
+        }
+
+        // or just the one field, which is a single flash read
+
+        static int16_t x(const uint8_t strip_nr, const uint16_t i)
+        {
+                return pgm_read_word(&entry(strip_nr, i)->x);
+        }
+
+        static int16_t y(const uint8_t strip_nr, const uint16_t i)
+        {
+                return pgm_read_word(&entry(strip_nr, i)->y);
+        }
+
+        static uint16_t angle(const uint8_t strip_nr, const uint16_t i)
+        {
+                return pgm_read_word(&entry(strip_nr, i)->angle);
+        }
+
+        static uint16_t radius(const uint8_t strip_nr, const uint16_t i)
+        {
+                return pgm_read_word(&entry(strip_nr, i)->radius);
+        }
+
+        static uint16_t distance(const uint8_t strip_nr, const uint16_t i)
+        {
+                return pgm_read_word(&entry(strip_nr, i)->distance);
+        }
+};
@@ -0,0 +1,214 @@
+// GoldenCheck.h
+//
+// Golden frame check for the LED programs. Renders every program for a fixed
+// set of inputs, for a few frames and every strip, and compares hashes of
+// each strip buffer against known good hashes kept in flash. Run it after
+// touching a program's fill loop or color math to see whether the output
+// changed at all.
+//
+// Each strip is hashed in segments of 16 pixels, so that a mismatch can say
+// which 16 pixels changed, and print them, rather than just that something
+// did. That's 18 bytes of flash per strip rendered; a full copy of the
+// pixels, to name the exact pixel, wouldn't fit.
+//
+// The table in golden_hashes.h is made by test/golden_test.cpp on a computer
+// ("make goldens" in test/), from the same programs.h. An empty or wrong
+// sized table is a failure, not a pass. The computer does ColorTempProg's
+// math in 64 bit doubles where the board has 32, so if the board disagrees
+// with a table the computer passes, look there first.
+
+#pragma once
+
+#include "LedProgram.h"
+#include "PixelHash.h"
+
+#include <Adafruit_DotStar.h>
+
+struct GoldenInputs
+{
+        uint16_t freq;
+        uint16_t brightness;
+};
+
+class GoldenCheck
+{
+private:
+        // low, middle and high on both pots
+        static constexpr uint8_t NR_CASES_ = 3;
+        static constexpr uint8_t NR_FRAMES_ = 4;
+        static constexpr uint8_t SEGMENT_PIXELS_ = 16;
+
+        static const GoldenInputs& inputs(const uint8_t c)
+        {
+                static const GoldenInputs cases[NR_CASES_] = {
+                        {0, 0},
+                        {512, 512},
+                        {1023, 1023}
+                };
+                return cases[c];
+        }
+
+        static constexpr uint8_t nrSegments(const uint16_t nr_pixels)
+        {
+                return (nr_pixels + SEGMENT_PIXELS_ - 1)/SEGMENT_PIXELS_;
+        }
+
+        // one past the last pixel of segment g
+        static uint16_t segmentEnd(Adafruit_DotStar& strip,
+                                   const uint8_t g)
+        {
+                const uint16_t end = (g + 1)*SEGMENT_PIXELS_;
+                return end < strip.numPixels() ? end : strip.numPixels();
+        }
+
+        // segment g of the strip, folded down to 16 bits
+        static uint16_t segmentHash(Adafruit_DotStar& strip,
+                                    const uint8_t g)
+        {
+                const uint16_t first = g*SEGMENT_PIXELS_;
+                const uint32_t hash = hashPixels(strip.getPixels() + 3*first,
+                                                 3*(segmentEnd(strip, g) - first));
+                return hash ^ (hash >> 16);
+        }
+
+        // which pixels of a mismatched strip differ, and what they are now
+        static void report(Print& out, const uint8_t p, const uint8_t c,
+                           const uint8_t f, const uint8_t s,
+                           Adafruit_DotStar& strip,
+                           const uint16_t *want, const bool print_pixels)
+        {
+                out.print(F("golden mismatch prog="));
+                out.print(p);
+                out.print(F(" case="));
+                out.print(c);
+                out.print(F(" frame="));
+                out.print(f);
+                out.print(F(" strip="));
+                out.print(s);
+                out.print(F(" pixels"));
+                for (uint8_t g = 0; g < nrSegments(strip.numPixels()); ++g) {
+                        if (segmentHash(strip, g) == pgm_read_word(&want[g]))
+                                continue;
+                        out.print(F(" "));
+                        out.print(g*SEGMENT_PIXELS_);
+                        out.print(F("-"));
+                        out.print(segmentEnd(strip, g) - 1);
+                }
+                out.println();
+
+                if (!print_pixels)
+                        return;
+
+                for (uint8_t g = 0; g < nrSegments(strip.numPixels()); ++g) {
+                        if (segmentHash(strip, g) == pgm_read_word(&want[g]))
+                                continue;
+                        for (uint16_t i = g*SEGMENT_PIXELS_;
+                             i < segmentEnd(strip, g); ++i) {
+                                out.print(F("  pixel "));
+                                out.print(i);
+                                out.print(F(" is 0x"));
+                                const uint32_t color = strip.getPixelColor(i);
+                                for (uint32_t d = 0x100000; d > 1 && color < d; d >>= 4)
+                                        out.print(F("0"));
+                                out.println(color, HEX);
+                        }
+                }
+        }
+
+public:
+        // the number of hashes a run produces, i.e. how big the golden
+        // table has to be
+        static constexpr uint16_t nrHashes(const uint8_t nr_progs,
+                                           const uint8_t nr_strips,
+                                           const uint16_t nr_pixels)
+        {
+                return (uint16_t)nr_progs * NR_CASES_ * NR_FRAMES_ * nr_strips
+                        * nrSegments(nr_pixels);
+        }
+
+        // render everything and compare against goldens (in PROGMEM), or
+        // with goldens NULL, print the hashes in golden_hashes.h format
+        // instead. Returns the number of strips that differ; a table of the
+        // wrong size, including an empty one, fails every strip without
+        // rendering anything.
+        //
+        // Every case runs frames 1 to NR_FRAMES_ of the animation clock (see
+        // LedProgram::clock()) at a steady frequency, which also seeds
+        // random() the same way every run. This renders into "strip" but
+        // never shows it, and it leaves the programs and the clock wherever
+        // the last frame put them; the next real frame sets the clock again.
+        static uint16_t run(LedProgram *const *progs, const uint8_t nr_progs,
+                            Adafruit_DotStar& strip, const uint8_t nr_strips,
+                            const uint16_t *goldens, const uint16_t nr_goldens,
+                            Print& out)
+        {
+                const uint8_t nr_segments = nrSegments(strip.numPixels());
+                const uint16_t nr_strips_run = (uint16_t)nr_progs * NR_CASES_
+                        * NR_FRAMES_ * nr_strips;
+                const uint16_t want_goldens = nrHashes(nr_progs, nr_strips,
+                                                       strip.numPixels());
+                uint16_t mismatches = 0;
+                uint16_t n = 0;
+
+                if (goldens && nr_goldens != want_goldens) {
+                        out.print(F("golden check FAILED: golden_hashes.h has "));
+                        out.print(nr_goldens);
+                        out.print(F(" hashes, want "));
+                        out.print(want_goldens);
+                        out.println(F(". Make them with \"make goldens\" in test/"));
+                        return nr_strips_run;
+                }
+
+                for (uint8_t p = 0; p < nr_progs; ++p) {
+                        for (uint8_t c = 0; c < NR_CASES_; ++c) {
+                                progs[p]->activate();
+                                for (uint8_t f = 0; f < NR_FRAMES_; ++f) {
+                                        LedProgram::startFrame({f + 1u,
+                                                                (f + 1u)*(uint32_t)inputs(c).freq});
+                                        for (uint8_t s = 0; s < nr_strips; ++s) {
+                                                progs[p]->updateStrip(strip, s,
+                                                                      inputs(c).brightness,
+                                                                      inputs(c).freq);
+
+                                                if (!goldens) {
+                                                        out.print(F("       "));
+                                                        for (uint8_t g = 0; g < nr_segments; ++g) {
+                                                                out.print(F(" 0x"));
+                                                                out.print(segmentHash(strip, g), HEX);
+                                                                out.print(F(","));
+                                                        }
+                                                        out.println();
+                                                        continue;
+                                                }
+
+                                                const uint16_t *want = goldens + n;
+                                                n += nr_segments;
+
+                                                bool same = true;
+                                                for (uint8_t g = 0; g < nr_segments; ++g)
+                                                        same &= segmentHash(strip, g)
+                                                                == pgm_read_word(&want[g]);
+                                                if (same)
+                                                        continue;
+
+                                                // only the first one's pixels,
+                                                // this is slow at 9600 baud
+                                                report(out, p, c, f, s, strip,
+                                                       want, mismatches++ == 0);
+                                        }
+                                }
+                        }
+                }
+
+                if (goldens) {
+                        out.print(F("golden check: "));
+                        out.print(mismatches);
+                        out.print(F(" of "));
+                        out.print(nr_strips_run);
+                        out.println(mismatches ? F(" strips differ, FAILED")
+                                    : F(" strips differ"));
+                }
+
+                return mismatches;
+        }
+};
@@ -0,0 +1,93 @@
+// InputTrace.h
+//
+// Scripted inputs for benchmarking. What loop() does depends on whatever the
+// pots and the rotary encoder happen to read, so two runs of the same code
+// never do quite the same work. While an InputTrace is playing, loop() takes
+// its inputs from the trace instead of from the hardware, so runs can be
+// compared against each other, e.g. before and after a change.
+
+#pragma once
+
+#include <Arduino.h>
+
+// one point in a trace. Traces live in flash (PROGMEM) as an array of these,
+// sorted by at_millis. Pot readings are interpolated linearly between
+// points; the program changes in steps. The last point marks the end of the
+// trace, its inputs are never used.
+struct TracePoint
+{
+        uint32_t at_millis;
+        uint16_t freq;
+        uint16_t brightness;
+        uint8_t prog;
+};
+
+class InputTrace
+{
+private:
+        const TracePoint *points_ = NULL;
+        uint8_t nr_points_ = 0;
+        uint8_t next_ = 0;
+        unsigned long start_millis_ = 0;
+
+        // the two points we're between
+        TracePoint from_;
+        TracePoint to_;
+
+        static TracePoint readPoint(const TracePoint *p)
+        {
+                TracePoint point;
+                memcpy_P(&point, p, sizeof point);
+                return point;
+        }
+
+        static uint16_t lerp(const uint16_t a, const uint16_t b,
+                             const uint32_t t, const uint32_t span)
+        {
+                return a + ((int32_t)b - a) * (int32_t)t / (int32_t)span;
+        }
+
+public:
+        // start playing a trace. points must be in PROGMEM and there must be
+        // at least two of them.
+        void begin(const TracePoint *points, const uint8_t nr_points)
+        {
+                points_ = points;
+                nr_points_ = nr_points;
+                start_millis_ = millis();
+                from_ = readPoint(&points_[0]);
+                to_ = readPoint(&points_[1]);
+                next_ = 2;
+        }
+
+        bool active() const
+        {
+                return points_ != NULL;
+        }
+
+        // get the inputs for time "now". Returns false (and leaves the inputs
+        // alone) once the trace is over, or if there is none.
+        bool read(const unsigned long now, uint16_t& freq,
+                  uint16_t& brightness, uint8_t& prog)
+        {
+                if (!points_)
+                        return false;
+
+                uint32_t t = now - start_millis_;
+                while (t >= to_.at_millis) {
+                        if (next_ == nr_points_) {
+                                points_ = NULL;
+                                return false;
+                        }
+                        from_ = to_;
+                        to_ = readPoint(&points_[next_++]);
+                }
+
+                uint32_t span = to_.at_millis - from_.at_millis;
+                t -= from_.at_millis;
+                freq = lerp(from_.freq, to_.freq, t, span);
+                brightness = lerp(from_.brightness, to_.brightness, t, span);
+                prog = from_.prog;
+                return true;
+        }
+};
@@ -0,0 +1,98 @@
+// LedOutput.h
+//
+// Output stages for the LED strips. loop() renders a strip into the one
+// Adafruit_DotStar buffer and hands it to an LedOutput, which decides how the
+// pixels actually leave the board.
+
+#pragma once
+
+#include <Adafruit_DotStar.h>
+
+class LedOutput
+{
+public:
+        virtual ~LedOutput() {}
+
+        // send the contents of "strip" to physical strip number strip_nr.
+        //
+        // Implementations must not modify the pixel buffer, since programs
+        // are allowed to re-use it for the next strip (see
+        // LedProgram::updateStrip()).
+        virtual void show(Adafruit_DotStar& strip, const uint8_t strip_nr) = 0;
+};
+
+// the original output path: point the DotStar class at the strip's clock and
+// data pins and let it bit-bang the buffer out.
+class DotStarOutput : public LedOutput
+{
+private:
+        const uint8_t *const data_pins_;
+        const uint8_t *const clk_pins_;
+
+public:
+        DotStarOutput(const uint8_t *data_pins, const uint8_t *clk_pins)
+                : data_pins_{data_pins}, clk_pins_{clk_pins}
+        {}
+
+        void show(Adafruit_DotStar& strip, const uint8_t strip_nr)
+        {
+                if (strip_nr == 0)
+                        strip.updatePins();
+                else
+                        strip.updatePins(data_pins_[strip_nr], clk_pins_[strip_nr]);
+
+                strip.show();
+        }
+};
+
+// writes each strip to a Stream (a spare hardware serial port, say) so the
+// output can be captured and checked on a computer without any LEDs
+// attached. Each strip goes out as a 4 byte header followed by the raw pixel
+// buffer, exactly as the DotStar class holds it (i.e. in the strip's color
+// order, before brightness scaling):
+//
+//   strip_nr, brightness, length high byte, length low byte, pixels...
+//
+// The buffer is handed to write() in one go, there's no per-pixel copy.
+class StreamOutput : public LedOutput
+{
+private:
+        Stream& stream_;
+
+public:
+        StreamOutput(Stream& stream) : stream_{stream} {}
+
+        void show(Adafruit_DotStar& strip, const uint8_t strip_nr)
+        {
+                const uint16_t nr_bytes = 3*strip.numPixels();
+                const uint8_t header[] = {
+                        strip_nr,
+                        strip.getBrightness(),
+                        (uint8_t)(nr_bytes >> 8),
+                        (uint8_t)(nr_bytes & 0xff)
+                };
+
+                stream_.write(header, sizeof header);
+                stream_.write(strip.getPixels(), nr_bytes);
+        }
+};
+
+// sends every strip to two outputs, e.g. the real strips plus a StreamOutput
+// to watch what they're being sent.
+class TeeOutput : public LedOutput
+{
+private:
+        LedOutput& first_;
+        LedOutput& second_;
+
+public:
+        TeeOutput(LedOutput& first, LedOutput& second)
+                : first_{first}, second_{second}
+        {}
+
+        void show(Adafruit_DotStar& strip, const uint8_t strip_nr)
+        {
+                first_.show(strip, strip_nr);
+                second_.show(strip, strip_nr);
+        }
+};
@@ -13,11 +13,54 @@ static const byte gc_table[256] = {
 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 7, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 10, 11, 11, 11, 12, 12, 13, 13, 14, 14, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20, 21, 21, 22, 22, 23, 24, 24, 25, 25, 26, 27, 27, 28, 29, 30, 30, 31, 32, 33, 33, 34, 35, 36, 37, 37, 38, 39, 40, 41, 42, 43, 44, 44, 45, 46, 47, 48, 49, 50, 51, 52, 54, 55, 56, 57, 58, 59, 60, 61, 62, 64, 65, 66, 67, 69, 70, 71, 72, 74, 75, 76, 78, 79, 81, 82, 83, 85, 86, 88, 89, 91, 92, 94, 95, 97, 98, 100, 102, 103, 105, 107, 108, 110, 112, 114, 115, 117, 119, 121, 123, 124, 126, 128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 157, 159, 161, 163, 165, 168, 170, 172, 175, 177, 179, 182, 184, 187, 189, 192, 194, 197, 199, 202, 204, 207, 209, 212, 215, 217, 220, 223, 226, 228, 231, 234, 237, 240, 243, 246, 249, 252, 255
 };
 
+// set pixels [from, to) of strip to one color.
+//
+// This is much faster than calling setPixelColor() for every pixel, which
+// re-does the color order shuffle and a bounds check each time. Instead we
+// let setPixelColor() pack the first pixel (so the strip's color order is
+// honored) and then copy those bytes over the rest of the range, doubling
+// the copied region each time. The result is byte-for-byte the same as the
+// setPixelColor() loop.
+static inline void fillPixels(Adafruit_DotStar& strip, const uint16_t from,
+                              const uint16_t to, const uint32_t color)
+{
+        if (from >= to)
+                return;
+
+        const uint16_t nr_bytes = 3*(to - from);
+        uint8_t *pixels = strip.getPixels() + 3*from;
+
+        strip.setPixelColor(from, color);
+        for (uint16_t done = 3; done < nr_bytes; done *= 2) {
+                uint16_t n = done < nr_bytes - done ? done : nr_bytes - done;
+                memcpy(pixels + done, pixels, n);
+        }
+}
+
+// where the animations are, see LedProgram::clock()
+struct FrameClock
+{
+        // frames since boot (or the leader's frame, see FrameSync.h)
+        uint32_t frame;
+        // the frequency, summed over all those frames
+        uint32_t freq_sum;
+};
+
 class LedProgram
 {
 public:
         virtual ~LedProgram() {}
 
+        // the engine calls this at the start of every frame, before the
+        // first strip. It also reseeds random() from the frame number, so
+        // programs that draw random numbers draw the same ones on every
+        // board that's in step.
+        static void startFrame(const FrameClock& c)
+        {
+                clockRef() = c;
+                randomSeed(scramble(c.frame) % 0x7fffffffUL + 1);
+        }
+
         // update a strip for the next tick.
         //
         // Derriving classes *must* implement this.
@@ -48,14 +91,89 @@ public:
         {
                 return 1 << 10;
         }
+
+        // programs that are expensive enough to miss their frame deadline
+        // can offer cheaper ways of rendering (fewer particles, half the
+        // resolution, ...) as quality levels. Level 0 is the best and the
+        // default; see QualityGovernor.h for who picks the level.
+        virtual uint8_t nrQualityLevels() const
+        {
+                return 1;
+        }
+
+        virtual void setQuality(const uint8_t level)
+        {
+                (void)level;
+        }
+
+        // programs that do the work for strip 0 and then re-use the buffer
+        // for the other strips (see updateStrip()) say so here. If a live
+        // input (see LiveInput.h) writes the buffer part way through a
+        // frame, led_monger.ino renders strip 0 again before the next strip,
+        // so strip 0 has to render the same every time within a frame.
+        virtual bool reusesFirstStrip() const
+        {
+                return false;
+        }
+
+        // called when this becomes the running program, before its first
+        // frame. Programs with per-strip state (see StripState.h) start it
+        // over here.
+        virtual void activate() {}
+
+protected:
+        // the animation clock. Anything that moves should work out where it
+        // is from this rather than keep its own count of steps: boards in
+        // step (see FrameSync.h) share the clock, so their animations line
+        // up too, whenever each board switched programs.
+        static const FrameClock& clock()
+        {
+                return clockRef();
+        }
+
+        // how far something has got that moves per_frame plus per_freq times
+        // the frequency every frame, e.g. a phase. This wraps at 2^32, so
+        // keep periods to powers of two.
+        static uint32_t travelled(const uint32_t per_frame, const uint32_t per_freq)
+        {
+                return per_frame*clock().frame + per_freq*clock().freq_sum;
+        }
+
+        // mix the bits of x, for random-looking numbers that are the same
+        // every time and on every board
+        static uint32_t scramble(uint32_t x)
+        {
+                x ^= x >> 16;
+                x *= 0x7feb352dUL;
+                x ^= x >> 15;
+                x *= 0x846ca68bUL;
+                x ^= x >> 16;
+                return x;
+        }
+
+        // fill the whole strip with one color, see fillPixels()
+        static void fillStrip(Adafruit_DotStar& strip, const uint32_t color)
+        {
+                fillPixels(strip, 0, strip.numPixels(), color);
+        }
+
+private:
+        static FrameClock& clockRef()
+        {
+                static FrameClock c;
+                return c;
+        }
 };
 
 
 class BlinkerProg : public LedProgram
 {
-private:
-        bool on = false;
 public:
+        bool reusesFirstStrip() const
+        {
+                return true;
+        }
+
         void updateStrip(Adafruit_DotStar& strip,
                          const uint8_t strip_nr,
                          const uint16_t brightness,
@@ -67,20 +185,21 @@ public:
                 if (strip_nr != 0)
                         return;
                 
-                on = !on;
+                bool on = clock().frame & 1;
 
                 uint32_t color = on ? strip.Color(255, 255, 255) : strip.Color(0, 0, 0);
-                for (size_t i = 0; i < strip.numPixels(); ++i) 
-                        strip.setPixelColor(i, color);
+                fillStrip(strip, color);
         }
 };
 
 class RgbBlinkerProg : public LedProgram
 {
-private:
-        bool on;
-        int rgb = 0;
 public:
+        bool reusesFirstStrip() const
+        {
+                return true;
+        }
+
         void updateStrip(Adafruit_DotStar& strip,
                          const uint8_t strip_nr,
                          const uint16_t brightness,
@@ -92,9 +211,9 @@ public:
                 if (strip_nr != 0)
                         return;
 
-                on = !on;
-                if (on)
-                        rgb = rgb == 2 ? 0 : rgb + 1;
+                // on, off, next color on, off, ...
+                bool on = clock().frame & 1;
+                uint8_t rgb = (clock().frame >> 1) % 3;
 
                 uint32_t color = 0;
                 switch (rgb) {
@@ -113,8 +232,7 @@ public:
                 }
 
                 color = on ? color : strip.Color(0, 0, 0);                
-                for (size_t i = 0; i < strip.numPixels(); ++i) 
-                        strip.setPixelColor(i, color);
+                fillStrip(strip, color);
         }
 };
 
@@ -138,6 +256,11 @@ private:
         }
 
 public:
+        bool reusesFirstStrip() const
+        {
+                return true;
+        }
+
         void updateStrip(Adafruit_DotStar& strip,
                          const uint8_t strip_nr,
                          const uint16_t brightness,
@@ -149,8 +272,7 @@ public:
                         return;
 
                 uint32_t color = wheel(strip, frequency/(maxFrequency()/255));
-                for (size_t i = 0; i < strip.numPixels(); ++i)
-                        strip.setPixelColor(i, color);
+                fillStrip(strip, color);
         }
 };
 
@@ -199,6 +321,11 @@ uint32_t color_temp_to_rgb(Adafruit_DotStar& strip, unsigned temp)
   return strip.Color(red, green, blue);
 }
 public:
+        bool reusesFirstStrip() const
+        {
+                return true;
+        }
+
         void updateStrip(Adafruit_DotStar& strip,
                          const uint8_t strip_nr,
                          const uint16_t brightness,
@@ -212,8 +339,75 @@ public:
                 // the constants here here are emperical aka black magic aka they
                 // made the prettiest colors
                 uint32_t color = color_temp_to_rgb(strip, 8*frequency + 1000);
-                for (size_t i = 0; i < strip.numPixels(); ++i)
-                        strip.setPixelColor(i, color);
+                fillStrip(strip, color);
+        }
+};
+
+
+class SparkleProg : public LedProgram
+{
+private:
+        // at full frequency, this many pixels per strip are lit each tick
+        static constexpr uint8_t MAX_SPARKLES_ = 32;
+
+public:
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                (void)strip_nr;
+                (void)brightness;
+
+                // every strip gets its own sparkles, so unlike the programs
+                // above we re-generate the buffer every time
+                fillStrip(strip, strip.Color(0, 0, 0));
+
+                uint8_t nr_sparkles = 1 + frequency/(maxFrequency()/MAX_SPARKLES_);
+                for (uint8_t i = 0; i < nr_sparkles; ++i)
+                        strip.setPixelColor(random(strip.numPixels()),
+                                            strip.Color(255, 255, 255));
         }
 };
 
+// a beam sweeping around the middle of the installation, like a radar
+// screen. Where each pixel is comes from Geometry (see Geometry.h), so this
+// never does any trig of its own.
+template <class Geometry>
+class RadarProg : public LedProgram
+{
+private:
+        // the beam's tail is this much of a turn long, in Geometry's angle
+        // units of 65536 to the turn
+        static constexpr uint16_t TAIL_ = 65536/8;
+
+public:
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                // the beam goes up to about a turn every 20 frames
+                const uint16_t phase = travelled(256, 3);
+
+                fillStrip(strip, strip.Color(0, 0, 0));
+                if (strip_nr >= Geometry::nrStrips())
+                        return;
+
+                uint16_t n = strip.numPixels();
+                if (n > Geometry::ledsPerStrip())
+                        n = Geometry::ledsPerStrip();
+
+                for (uint16_t i = 0; i < n; ++i) {
+                        uint16_t behind = phase - Geometry::angle(strip_nr, i);
+                        if (behind >= TAIL_)
+                                continue;
+
+                        uint8_t v = gc_table[255 - behind/(TAIL_/256)];
+                        strip.setPixelColor(i, strip.Color(0, v, v/4));
+                }
+        }
+};
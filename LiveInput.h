@@ -0,0 +1,107 @@
+// LiveInput.h
+//
+// Base class for sources of pixels from outside the board (a lighting desk,
+// a pattern generator on a computer, ...).
+//
+// Live inputs and the built-in programs share the one strip buffer and take
+// turns at it. A live input owns the strips it has sent recently, and the
+// programs keep running on the rest, so e.g. a visualizer can drive two
+// strips while the current program drives the other six.
+
+#pragma once
+
+#include "LedOutput.h"
+
+#include <Adafruit_DotStar.h>
+
+class LiveInput
+{
+private:
+        // strip ownership is a bitmask, so this is as many strips as we
+        // support
+        static constexpr uint8_t MAX_STRIPS_ = 8;
+
+        unsigned long shown_millis_[MAX_STRIPS_];
+        uint8_t shown_mask_ = 0;
+
+        uint32_t min_latency_ = 0xffffffff;
+        uint32_t max_latency_ = 0;
+        uint32_t last_latency_ = 0;
+
+protected:
+        // a strip we haven't sent for this long goes back to the programs.
+        // This is the sACN "network data loss" timeout.
+        static constexpr unsigned long TIMEOUT_MILLIS_ = 2500;
+
+        // implementations call this after sending strip strip_nr.
+        // arrival_micros is when the first byte of the data for it arrived,
+        // so we can keep track of the latency from the sender to the strip.
+        void shown(const uint8_t strip_nr, const unsigned long arrival_micros)
+        {
+                uint32_t latency = micros() - arrival_micros;
+                last_latency_ = latency;
+                if (latency < min_latency_)
+                        min_latency_ = latency;
+                if (latency > max_latency_)
+                        max_latency_ = latency;
+
+                if (strip_nr < MAX_STRIPS_) {
+                        shown_millis_[strip_nr] = millis();
+                        shown_mask_ |= 1 << strip_nr;
+                }
+        }
+
+public:
+        virtual ~LiveInput() {}
+
+        // handle whatever input is waiting, writing pixels into "strip" and
+        // sending them out through "output". Implementations must bound the
+        // amount of work done per call so they can't stall loop().
+        //
+        // Returns true if anything was written to the strips or the strip
+        // buffer, in which case the strip buffer has been clobbered.
+        virtual bool poll(Adafruit_DotStar& strip, LedOutput& output) = 0;
+
+        // is something half written into the strip buffer? If so nobody
+        // else may touch the buffer until this input finishes with it.
+        virtual bool busy(const unsigned long now) const
+        {
+                (void)now;
+                return false;
+        }
+
+        // bitmask of the strips this input has sent recently. The programs
+        // leave these strips alone.
+        uint8_t ownedStrips(const unsigned long now) const
+        {
+                uint8_t owned = 0;
+                for (uint8_t i = 0; i < MAX_STRIPS_; ++i)
+                        if (shown_mask_ & (1 << i)
+                            && now - shown_millis_[i] < TIMEOUT_MILLIS_)
+                                owned |= 1 << i;
+                return owned;
+        }
+
+        // latency from the first byte of a strip's data arriving to that
+        // strip having been sent, in micros
+        uint32_t minLatency() const
+        {
+                return min_latency_;
+        }
+
+        uint32_t maxLatency() const
+        {
+                return max_latency_;
+        }
+
+        uint32_t lastLatency() const
+        {
+                return last_latency_;
+        }
+
+        void resetLatency()
+        {
+                min_latency_ = 0xffffffff;
+                max_latency_ = 0;
+        }
+};
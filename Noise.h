@@ -0,0 +1,276 @@
+// Noise.h
+//
+// Fixed point gradient (Perlin) noise, for things that should look organic:
+// water, clouds, candle flicker.
+//
+// This is Ken Perlin's improved noise, done in integers since the AVR has no
+// floating point. Coordinates are 16.16 fixed point: the integer part picks a
+// lattice cell (the lattice repeats every 256 cells), the fraction is where
+// in the cell we are. Results are in [-32768, 32767].
+//
+// The differences from the reference implementation are that the permutation
+// table lives in flash and is indexed mod 256 rather than being doubled, and
+// the fade curve is the cubic 3t^2 - 2t^3 rather than the quintic, which
+// would take two more multiplies. Offsets within a cell are kept in
+// 1/16384ths of a cell so that gradient sums fit in 16 bits.
+//
+// Multiplies are what this costs on the board. The AVR only has an 8x8 bit
+// MUL; a 16 bit multiply is a few of those inline, but the 32 bit ones here
+// (in fade() and lerp(), whose products need 32 bits) are calls into libgcc
+// that take tens of cycles each. test/noise_test.cpp counts them: a full
+// noise3() does 19, and a NoiseLine pixel 11 (fade() for x and the 7
+// lerps), none of them 16 bit. That's why NoiseProgs.h uses NoiseLine
+// wherever pixels lie along one noise axis, and why both its per-pixel
+// programs offer quality levels that sample fewer points.
+//
+// NoiseLine evaluates 3D noise at evenly spaced points along x, e.g. along a
+// strip. Points in the same cell share the 8 corner hashes and all the y and
+// z terms, so it only goes back to the permutation table when it steps into
+// a new cell.
+//
+// The programs built on this are in NoiseProgs.h. This only needs
+// <Arduino.h>, so test/noise_test.cpp can run it on a computer with the
+// AVR's 16 bit int.
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace noise {
+
+// Ken Perlin's permutation of 0-255
+static const uint8_t PERM[256] PROGMEM = {
+        151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225,
+        140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148,
+        247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203, 117, 35, 11, 32,
+        57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+        74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122,
+        60, 211, 133, 230, 220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54,
+        65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89, 18, 169,
+        200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64,
+        52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+        207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213,
+        119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+        129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104,
+        218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162, 241,
+        81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+        184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93,
+        222, 114, 67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180
+};
+
+// one cell, in the units offsets within a cell are kept in
+static constexpr int16_t ONE = 16384;
+
+static inline uint8_t perm(const uint8_t i)
+{
+        return pgm_read_byte(PERM + i);
+}
+
+// 3t^2 - 2t^3, with t and the result in 1/65536ths
+static inline uint16_t fade(const uint16_t t)
+{
+        uint32_t t2 = ((uint32_t)t * t) >> 16;
+        uint32_t t3 = (t2 * t) >> 16;
+        uint32_t f = 3*t2 - 2*t3;
+        return f > 0xffff ? 0xffff : f;
+}
+
+// a + (b - a)t, with t in 1/65536ths. b - a takes 17 bits, so it has to be
+// worked out in 32 (int is only 16 on the AVR), and then t gives up its
+// bottom bit so that the product still fits.
+static inline int16_t lerp(const int16_t a, const int16_t b, const uint16_t t)
+{
+        return a + ((((int32_t)b - a) * (t >> 1)) >> 15);
+}
+
+// the dot product of the offset (x, y, z) with one of the 12 gradients
+// (+-1, +-1, 0), (+-1, 0, +-1), (0, +-1, +-1) picked by the hash
+static inline int16_t grad3(const uint8_t hash, const int16_t x,
+                            const int16_t y, const int16_t z)
+{
+        const uint8_t h = hash & 15;
+        const int16_t u = h < 8 ? x : y;
+        const int16_t v = h < 4 ? y : h == 12 || h == 14 ? x : z;
+
+        // at a far corner u and v can both be -ONE, and with both flipped
+        // the sum is one past the biggest int16_t
+        const int32_t dot = (int32_t)((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+        return dot > 32767 ? 32767 : dot;
+}
+
+// gradients of 1/8 to 1 either way
+static inline int16_t grad1(const uint8_t hash, const int16_t x)
+{
+        const int16_t g = ((int32_t)x * ((hash & 7) + 1)) >> 3;
+        return hash & 8 ? -g : g;
+}
+
+// scale up to the full 16 bits, saturating
+static inline int16_t stretch(const int16_t x, const uint8_t shift)
+{
+        const int32_t s = (int32_t)x << shift;
+        return s > 32767 ? 32767 : s < -32768 ? -32768 : s;
+}
+
+// how far the interpolated results can get from 0, as a shift back up to
+// 16 bits, in cells: 1D noise with our gradients stays within half a cell of
+// 0, 2D and 3D within a cell.
+static constexpr uint8_t SHIFT_1D = 2;
+static constexpr uint8_t SHIFT_3D = 1;
+
+}
+
+class Noise
+{
+public:
+        static int16_t noise1(const uint32_t x)
+        {
+                using namespace noise;
+
+                const uint8_t X = x >> 16;
+                const int16_t x0 = (uint16_t)x >> 2;
+
+                return stretch(lerp(grad1(perm(X), x0),
+                                    grad1(perm(X + 1), x0 - ONE),
+                                    fade(x)),
+                               SHIFT_1D);
+        }
+
+        // 3D noise on the z = 0 plane
+        static int16_t noise2(const uint32_t x, const uint32_t y)
+        {
+                using namespace noise;
+
+                const uint8_t X = x >> 16;
+                const uint8_t Y = y >> 16;
+                const int16_t x0 = (uint16_t)x >> 2;
+                const int16_t y0 = (uint16_t)y >> 2;
+                const uint16_t u = fade(x);
+
+                const uint8_t A = perm(X) + Y;
+                const uint8_t B = perm(X + 1) + Y;
+
+                return stretch(lerp(lerp(grad3(perm(perm(A)), x0, y0, 0),
+                                         grad3(perm(perm(B)), x0 - ONE, y0, 0), u),
+                                    lerp(grad3(perm(perm(A + 1)), x0, y0 - ONE, 0),
+                                         grad3(perm(perm(B + 1)), x0 - ONE, y0 - ONE, 0), u),
+                                    fade(y)),
+                               SHIFT_3D);
+        }
+
+        static int16_t noise3(const uint32_t x, const uint32_t y, const uint32_t z)
+        {
+                using namespace noise;
+
+                const uint8_t X = x >> 16;
+                const uint8_t Y = y >> 16;
+                const uint8_t Z = z >> 16;
+                const int16_t x0 = (uint16_t)x >> 2;
+                const int16_t y0 = (uint16_t)y >> 2;
+                const int16_t z0 = (uint16_t)z >> 2;
+                const int16_t x1 = x0 - ONE;
+                const int16_t y1 = y0 - ONE;
+                const int16_t z1 = z0 - ONE;
+                const uint16_t u = fade(x);
+                const uint16_t v = fade(y);
+
+                const uint8_t A = perm(X) + Y;
+                const uint8_t AA = perm(A) + Z;
+                const uint8_t AB = perm(A + 1) + Z;
+                const uint8_t B = perm(X + 1) + Y;
+                const uint8_t BA = perm(B) + Z;
+                const uint8_t BB = perm(B + 1) + Z;
+
+                return stretch(lerp(lerp(lerp(grad3(perm(AA), x0, y0, z0),
+                                              grad3(perm(BA), x1, y0, z0), u),
+                                         lerp(grad3(perm(AB), x0, y1, z0),
+                                              grad3(perm(BB), x1, y1, z0), u), v),
+                                    lerp(lerp(grad3(perm(AA + 1), x0, y0, z1),
+                                              grad3(perm(BA + 1), x1, y0, z1), u),
+                                         lerp(grad3(perm(AB + 1), x0, y1, z1),
+                                              grad3(perm(BB + 1), x1, y1, z1), u), v),
+                                    fade(z)),
+                               SHIFT_3D);
+        }
+};
+
+// noise3(x, y, z), noise3(x + dx, y, z), noise3(x + 2dx, y, z), ...
+class NoiseLine
+{
+private:
+        uint32_t x_;
+        const uint32_t dx_;
+
+        // the y and z terms, which don't change along the line
+        const int16_t y0_;
+        const int16_t z0_;
+        const uint16_t v_;
+        const uint16_t w_;
+        const uint8_t Y_;
+        const uint8_t Z_;
+
+        // the cell we're in, and its corners' hashes
+        uint8_t X_;
+        uint8_t hashes_[8];
+
+        void enterCell(const uint8_t X)
+        {
+                using noise::perm;
+
+                X_ = X;
+                const uint8_t A = perm(X) + Y_;
+                const uint8_t AA = perm(A) + Z_;
+                const uint8_t AB = perm(A + 1) + Z_;
+                const uint8_t B = perm(X + 1) + Y_;
+                const uint8_t BA = perm(B) + Z_;
+                const uint8_t BB = perm(B + 1) + Z_;
+
+                hashes_[0] = perm(AA);
+                hashes_[1] = perm(BA);
+                hashes_[2] = perm(AB);
+                hashes_[3] = perm(BB);
+                hashes_[4] = perm(AA + 1);
+                hashes_[5] = perm(BA + 1);
+                hashes_[6] = perm(AB + 1);
+                hashes_[7] = perm(BB + 1);
+        }
+
+public:
+        NoiseLine(const uint32_t x, const uint32_t dx, const uint32_t y,
+                  const uint32_t z)
+                : x_{x}, dx_{dx},
+                  y0_{(int16_t)((uint16_t)y >> 2)}, z0_{(int16_t)((uint16_t)z >> 2)},
+                  v_{noise::fade(y)}, w_{noise::fade(z)},
+                  Y_{(uint8_t)(y >> 16)}, Z_{(uint8_t)(z >> 16)}
+        {
+                enterCell(x >> 16);
+        }
+
+        // the noise at the current point, then step to the next one
+        int16_t next()
+        {
+                using namespace noise;
+
+                const uint8_t X = x_ >> 16;
+                if (X != X_)
+                        enterCell(X);
+
+                const int16_t x0 = (uint16_t)x_ >> 2;
+                const int16_t x1 = x0 - ONE;
+                const int16_t y1 = y0_ - ONE;
+                const int16_t z1 = z0_ - ONE;
+                const uint16_t u = fade(x_);
+                x_ += dx_;
+
+                return stretch(lerp(lerp(lerp(grad3(hashes_[0], x0, y0_, z0_),
+                                              grad3(hashes_[1], x1, y0_, z0_), u),
+                                         lerp(grad3(hashes_[2], x0, y1, z0_),
+                                              grad3(hashes_[3], x1, y1, z0_), u), v_),
+                                    lerp(lerp(grad3(hashes_[4], x0, y0_, z1),
+                                              grad3(hashes_[5], x1, y0_, z1), u),
+                                         lerp(grad3(hashes_[6], x0, y1, z1),
+                                              grad3(hashes_[7], x1, y1, z1), u), v_),
+                                    w_),
+                               SHIFT_3D);
+        }
+};
@@ -0,0 +1,199 @@
+// NoiseProgs.h
+//
+// Programs built on the gradient noise in Noise.h.
+//
+// Noise is smooth from one pixel to the next, so the expensive ones offer
+// quality levels (see QualityGovernor.h) that sample it every 2nd or 4th
+// pixel and draw straight lines in between.
+
+#pragma once
+
+#include "Canvas.h"
+#include "LedProgram.h"
+#include "Noise.h"
+
+#include <Adafruit_DotStar.h>
+
+// map noise onto 0-255
+static inline uint8_t noiseByte(const int16_t n)
+{
+        return (uint16_t)(n + 32768) >> 8;
+}
+
+// quality level q samples every 2^q'th pixel
+static constexpr uint8_t NOISE_QUALITY_LEVELS = 3;
+
+// pixel j of the 2^shift from sample a to sample b, on a straight line
+static inline uint8_t between(const uint8_t a, const uint8_t b, const uint8_t j,
+                              const uint8_t shift)
+{
+        return a + (((int16_t)(b - a) * j) >> shift);
+}
+
+// ripples of light on water, flowing from one strip into the next. Each
+// strip is one NoiseLine across its part of the canvas, so the permutation
+// table is only read every 32 pixels.
+class WaterProg : public CanvasProg
+{
+private:
+        // a cell is 32 pixels
+        static constexpr uint32_t DX_ = 65536/32;
+
+        // time, which is the noise's z
+        uint32_t t_ = 0;
+        // and a slow current along the canvas
+        uint32_t drift_ = 0;
+
+        uint8_t quality_ = 0;
+
+protected:
+        void step(const uint16_t brightness, const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                // at full frequency, a cell every 8 frames or so
+                t_ = travelled(512, 8);
+                drift_ = travelled(128, 2);
+        }
+
+        void render(Canvas& canvas, const uint16_t brightness,
+                    const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                // samples are step pixels apart, and the line takes one
+                // past the end of the strip, to draw up to
+                const uint8_t step = 1 << quality_;
+                NoiseLine line{canvas.first()*DX_ + drift_, DX_ << quality_, 0, t_};
+                uint8_t a = noiseByte(line.next());
+                for (uint16_t i = canvas.first(); i < canvas.end(); i += step) {
+                        const uint8_t b = noiseByte(line.next());
+                        for (uint8_t j = 0; j < step && i + j < canvas.end(); ++j) {
+                                uint8_t v = gc_table[between(a, b, j, quality_)];
+                                canvas.set(i + j, Adafruit_DotStar::Color(v/8, v/2,
+                                                                          24 + ((v*231u) >> 8)));
+                        }
+                        a = b;
+                }
+        }
+
+public:
+        WaterProg(const uint8_t nr_strips) : CanvasProg{nr_strips} {}
+
+        uint8_t nrQualityLevels() const
+        {
+                return NOISE_QUALITY_LEVELS;
+        }
+
+        void setQuality(const uint8_t level)
+        {
+                quality_ = level;
+        }
+};
+
+// every strip is a candle flame, flickering on its own. Two octaves of 1D
+// noise over time: a slow one for the flame swaying, a fast one for the
+// flicker.
+class CandleProg : public LedProgram
+{
+private:
+        // far enough apart in the noise that no two strips look alike
+        static constexpr uint32_t STRIP_APART_ = 37*65536UL;
+
+public:
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                // at full frequency, about half a cell a frame
+                const uint32_t t = travelled(4096, 32) + strip_nr*STRIP_APART_;
+                int16_t n = (Noise::noise1(t) >> 1) + (Noise::noise1(t << 2) >> 2);
+
+                // mostly lit, never out
+                int16_t level = 176 + (n >> 8);
+                uint8_t v = gc_table[level > 255 ? 255 : level];
+
+                fillStrip(strip, strip.Color(v, (v*3u) >> 3, v/16));
+        }
+};
+
+// clouds drifting over a blue sky, in space rather than along the strips:
+// the noise is sampled where each pixel is (see Geometry.h), so the clouds
+// cross from one side of the table to the other. This is a full noise3() per
+// sample, as the pixels of a strip needn't lie along one noise axis, so it's
+// the one most likely to need a lower quality level.
+template <class Geometry>
+class CloudsProg : public LedProgram
+{
+private:
+        // a cell is about half a meter
+        static constexpr uint32_t PER_MM_ = 65536/500;
+
+        uint8_t quality_ = 0;
+
+        // the noise at pixel i of a strip of n, or at the last pixel if i
+        // is past it, as 0-255
+        static uint8_t density(const uint8_t strip_nr, uint16_t i, const uint16_t n,
+                               const uint32_t t, const uint32_t wind)
+        {
+                if (i >= n)
+                        i = n - 1;
+                const uint32_t x = Geometry::x(strip_nr, i)*PER_MM_ + wind;
+                const uint32_t y = Geometry::y(strip_nr, i)*PER_MM_;
+                return noiseByte(Noise::noise3(x, y, t));
+        }
+
+public:
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                const uint32_t t = travelled(256, 2);
+                const uint32_t wind = travelled(512, 4);
+
+                fillStrip(strip, strip.Color(0, 0, 0));
+                if (strip_nr >= Geometry::nrStrips())
+                        return;
+
+                uint16_t n = strip.numPixels();
+                if (n > Geometry::ledsPerStrip())
+                        n = Geometry::ledsPerStrip();
+
+                const uint8_t step = 1 << quality_;
+                uint8_t a = density(strip_nr, 0, n, t, wind);
+                for (uint16_t i = 0; i < n; i += step) {
+                        const uint8_t b = density(strip_nr, i + step, n, t, wind);
+                        for (uint8_t j = 0; j < step && i + j < n; ++j) {
+                                // the top half of the noise is cloud, the
+                                // rest sky
+                                uint8_t d = between(a, b, j, quality_);
+                                d = d < 128 ? 0 : gc_table[(d - 128) << 1];
+
+                                strip.setPixelColor(i + j, strip.Color(16 + ((d*239u) >> 8),
+                                                                       48 + ((d*207u) >> 8),
+                                                                       160 + ((d*95u) >> 8)));
+                        }
+                        a = b;
+                }
+        }
+
+        uint8_t nrQualityLevels() const
+        {
+                return NOISE_QUALITY_LEVELS;
+        }
+
+        void setQuality(const uint8_t level)
+        {
+                quality_ = level;
+        }
+};
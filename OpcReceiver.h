@@ -0,0 +1,273 @@
+// OpcReceiver.h
+//
+// Open Pixel Control (http://openpixelcontrol.org) receiver, so the pattern
+// generators we already have on the computer can drive the strips.
+//
+// OPC is normally spoken over TCP, but the message format doesn't care what
+// it runs over, and the Mega doesn't have a network interface. So we speak it
+// over a serial port, and the computer runs a TCP to serial bridge, e.g.
+//
+//   socat TCP-LISTEN:7890,fork,reuseaddr FILE:/dev/ttyUSB0,b1000000,raw
+//
+// Only one client should send at a time, since the bridge just interleaves
+// their bytes.
+//
+// Messages are parsed a byte at a time as they come in, and pixels are written
+// straight into the strip buffer, so there is no message buffer at all. That
+// makes us busy() from the header to the end of the message, or until we
+// give up on it, and in that case poll() says the buffer was clobbered so
+// that nobody trusts what was in it. The OPC channel is the strip index, as
+// in led_clk_pins.
+//
+// At 1Mbaud the serial port's 64 byte receive ring fills in about 0.6ms, and
+// showing a strip takes longer than that, so a client streaming flat out will
+// lose bytes. OPC has no framing, so one lost byte would leave every message
+// after it misaligned. To find our way back, we only accept headers that make
+// sense for us: set-pixel-colors, for a strip we have, with a whole number of
+// pixels that fit on it. Anything else is taken to be the middle of a
+// message, and we slide along a byte at a time until a header does make
+// sense. A lost byte costs two messages: the one it went missing from is
+// shown a pixel shifted, and since that one then ends a byte late, the
+// header after it is eaten too. The one after that is fine. Other OPC
+// commands (system exclusive) look like noise to us, and are skipped the
+// same way.
+//
+// Clients should pace themselves to what "stats" says we keep up with: the
+// overruns count polls that found the receive ring full, which means bytes
+// were lost.
+
+#pragma once
+
+#include "LedOutput.h"
+#include "LiveInput.h"
+
+#include <Adafruit_DotStar.h>
+
+class OpcReceiver : public LiveInput
+{
+private:
+        static constexpr uint8_t HEADER_SIZE_ = 4;
+        static constexpr uint8_t CMD_SET_PIXEL_COLORS_ = 0;
+        static constexpr uint8_t NO_STRIP_ = 0xff;
+
+        // HardwareSerial's 64 byte ring holds at most 63 bytes, and when
+        // it's that full, anything else that arrives is dropped
+        static constexpr uint16_t RX_RING_FULL_ = 63;
+
+        // OPC has no framing, so if a message stops half way through we'd
+        // be out of sync forever, and busy. If nothing arrives for this long
+        // in the middle of a message, we drop it and expect a new header.
+        static constexpr unsigned long RESYNC_MILLIS_ = 100;
+
+        // upper bound on how much serial input one call to poll() will eat,
+        // so that a flood of data can't stall loop()
+        static constexpr uint16_t MAX_BYTES_PER_POLL_ = 128;
+
+        Stream& stream_;
+        const uint8_t nr_strips_;
+
+        // parser state
+        uint8_t header_[HEADER_SIZE_];
+        uint8_t header_pos_ = 0;
+        uint16_t remaining_ = 0;
+        uint8_t target_ = NO_STRIP_;
+        uint16_t pixel_ = 0;
+        uint8_t rgb_[3];
+        uint8_t rgb_pos_ = 0;
+        // sliding along looking for a header that makes sense
+        bool lost_ = false;
+
+        unsigned long last_data_millis_ = 0;
+        unsigned long arrival_micros_ = 0;
+
+        // stats
+        uint32_t messages_ = 0;
+        uint32_t resyncs_ = 0;
+        uint32_t skipped_ = 0;
+        uint32_t bytes_ = 0;
+        uint32_t full_polls_ = 0;
+        uint32_t overruns_ = 0;
+        uint16_t max_backlog_ = 0;
+
+        bool plausibleHeader(Adafruit_DotStar& strip) const
+        {
+                const uint16_t length = (uint16_t)header_[2] << 8 | header_[3];
+                return header_[1] == CMD_SET_PIXEL_COLORS_
+                        && header_[0] < nr_strips_
+                        && length % 3 == 0 && length <= 3*strip.numPixels();
+        }
+
+        // the header doesn't make sense, so its first byte was the middle
+        // of some message: drop it and try the next 4
+        void slideHeader()
+        {
+                if (!lost_)
+                        ++resyncs_;
+                lost_ = true;
+                ++skipped_;
+                memmove(header_, header_ + 1, HEADER_SIZE_ - 1);
+                header_pos_ = HEADER_SIZE_ - 1;
+        }
+
+        void startMessage(Adafruit_DotStar& strip)
+        {
+                lost_ = false;
+                remaining_ = (uint16_t)header_[2] << 8 | header_[3];
+                pixel_ = 0;
+                rgb_pos_ = 0;
+
+                // the strip buffer still holds some other strip, and a
+                // message may not cover every pixel. Pixels it doesn't
+                // mention are black.
+                target_ = header_[0];
+                memset(strip.getPixels(), 0, 3*strip.numPixels());
+        }
+
+        // give up on a message that stopped half way. Returns true if it had
+        // started writing the strip buffer.
+        bool abandonMessage()
+        {
+                const bool clobbered = target_ != NO_STRIP_;
+                header_pos_ = 0;
+                target_ = NO_STRIP_;
+                ++resyncs_;
+                return clobbered;
+        }
+
+        // returns true if the message was shown on a strip
+        bool finishMessage(Adafruit_DotStar& strip, LedOutput& output)
+        {
+                header_pos_ = 0;
+                if (target_ == NO_STRIP_)
+                        return false;
+
+                output.show(strip, target_);
+                shown(target_, arrival_micros_);
+                target_ = NO_STRIP_;
+                ++messages_;
+                return true;
+        }
+
+public:
+        OpcReceiver(Stream& stream, const uint8_t nr_strips)
+                : stream_{stream}, nr_strips_{nr_strips}
+        {}
+
+        bool poll(Adafruit_DotStar& strip, LedOutput& output)
+        {
+                bool any_shown = false;
+
+                // the sender went quiet in the middle of a message. This
+                // has to happen here rather than when the next byte turns
+                // up, since it may never turn up, and until then the strip
+                // buffer is ours.
+                if ((header_pos_ != 0 || target_ != NO_STRIP_)
+                    && millis() - last_data_millis_ > RESYNC_MILLIS_)
+                        any_shown |= abandonMessage();
+
+                uint16_t backlog = stream_.available();
+                if (backlog > max_backlog_)
+                        max_backlog_ = backlog;
+                if (backlog >= RX_RING_FULL_)
+                        ++overruns_;
+
+                uint16_t n;
+                for (n = 0; n < MAX_BYTES_PER_POLL_; ++n) {
+                        int c = stream_.read();
+                        if (c < 0)
+                                break;
+
+                        ++bytes_;
+                        last_data_millis_ = millis();
+
+                        if (header_pos_ < HEADER_SIZE_) {
+                                if (header_pos_ == 0)
+                                        arrival_micros_ = micros();
+                                header_[header_pos_++] = c;
+                                if (header_pos_ == HEADER_SIZE_) {
+                                        if (!plausibleHeader(strip)) {
+                                                slideHeader();
+                                                continue;
+                                        }
+                                        startMessage(strip);
+                                        if (remaining_ == 0)
+                                                any_shown |= finishMessage(strip, output);
+                                }
+                                continue;
+                        }
+
+                        rgb_[rgb_pos_++] = c;
+                        if (rgb_pos_ == 3) {
+                                strip.setPixelColor(pixel_++, rgb_[0], rgb_[1], rgb_[2]);
+                                rgb_pos_ = 0;
+                        }
+
+                        if (--remaining_ == 0)
+                                any_shown |= finishMessage(strip, output);
+                }
+
+                // if we ran into the bound there's more waiting, which means
+                // the sender is getting ahead of us
+                if (n == MAX_BYTES_PER_POLL_)
+                        ++full_polls_;
+
+                return any_shown;
+        }
+
+        // a half received message lives in the strip buffer. That lasts
+        // until it's done or poll() gives up on it, however long that is.
+        bool busy(const unsigned long now) const
+        {
+                (void)now;
+                return target_ != NO_STRIP_;
+        }
+
+        // set-pixel-colors messages shown on a strip
+        uint32_t messages() const
+        {
+                return messages_;
+        }
+
+        // times we lost our place in the stream: a message the sender
+        // stopped half way through, or a header that made no sense
+        uint32_t resyncs() const
+        {
+                return resyncs_;
+        }
+
+        // bytes skipped looking for a header that makes sense
+        uint32_t skipped() const
+        {
+                return skipped_;
+        }
+
+        uint32_t bytes() const
+        {
+                return bytes_;
+        }
+
+        // backpressure: how many polls stopped with input still waiting,
+        // how many found the serial receive ring full (so bytes were
+        // dropped), and the most input we ever found waiting in it
+        uint32_t fullPolls() const
+        {
+                return full_polls_;
+        }
+
+        uint32_t overruns() const
+        {
+                return overruns_;
+        }
+
+        uint16_t maxBacklog() const
+        {
+                return max_backlog_;
+        }
+
+        void resetStats()
+        {
+                messages_ = resyncs_ = skipped_ = bytes_ = full_polls_ = 0;
+                overruns_ = 0;
+                max_backlog_ = 0;
+        }
+};
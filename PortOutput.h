@@ -0,0 +1,117 @@
+// PortOutput.h
+//
+// A faster way of bit-banging the strips than the DotStar class.
+//
+// Adafruit_DotStar's software SPI does a read-modify-write through a pointer
+// for every edge, and a function call for every byte, which comes to about
+// 21 cycles a bit. Here every pin change is a single write to the pin's PINx
+// register, which toggles the bits written to it. The clock is two such
+// writes per bit, and the data pin is only written when the next bit differs
+// from the last one. Counting instructions that ought to be well under the
+// DotStar class's time per strip, but it hasn't been timed on the board yet,
+// so it isn't the default: set use_port_output in led_monger.ino and compare
+// "show took" (telemetry 2) or the SCOPE_SHOW marker against the DotStar
+// class. Since nothing reads the port back, an interrupt that touches another
+// pin on the same port can't be lost, so interrupts stay on throughout.
+//
+// The bytes sent are exactly what Adafruit_DotStar::show() sends: a start
+// frame, a 0xff header and three brightness scaled color bytes per LED, and
+// the end frame. test/port_output_test.cpp follows the pin writes on a
+// computer and decodes them as an APA102 would.
+
+#pragma once
+
+#include "LedOutput.h"
+
+#include <Adafruit_DotStar.h>
+#include <Arduino.h>
+
+class PortOutput : public LedOutput
+{
+private:
+        // a PINx register: volatile uint8_t * on the board
+        typedef decltype(portInputRegister(0)) ToggleRegister;
+
+        const uint8_t *const data_pins_;
+        const uint8_t *const clk_pins_;
+        const uint8_t nr_strips_;
+
+        // clock one byte out, MSB first. level is the data pin's level, as
+        // 0 or 1, before and after.
+        static void byteOut(ToggleRegister data_toggle, const uint8_t data_mask,
+                            ToggleRegister clk_toggle, const uint8_t clk_mask,
+                            uint8_t& level, const uint8_t b)
+        {
+                // bit i of toggles is set if the data pin has to change
+                // before bit i goes out
+                uint8_t toggles = b ^ (b >> 1 | level << 7);
+                level = b & 1;
+
+                for (uint8_t i = 0; i < 8; ++i, toggles <<= 1) {
+                        if (toggles & 0x80)
+                                *data_toggle = data_mask;
+                        *clk_toggle = clk_mask;
+                        *clk_toggle = clk_mask;
+                }
+        }
+
+public:
+        PortOutput(const uint8_t *data_pins, const uint8_t *clk_pins,
+                   const uint8_t nr_strips)
+                : data_pins_{data_pins}, clk_pins_{clk_pins},
+                  nr_strips_{nr_strips}
+        {}
+
+        // the clocks have to start out low, since we only ever toggle them
+        void begin()
+        {
+                for (uint8_t i = 0; i < nr_strips_; ++i) {
+                        digitalWrite(clk_pins_[i], LOW);
+                        pinMode(clk_pins_[i], OUTPUT);
+                        pinMode(data_pins_[i], OUTPUT);
+                }
+        }
+
+        void show(Adafruit_DotStar& strip, const uint8_t strip_nr)
+        {
+                if (strip_nr >= nr_strips_)
+                        return;
+
+                const uint8_t data_pin = data_pins_[strip_nr];
+                const uint8_t clk_pin = clk_pins_[strip_nr];
+                ToggleRegister data_toggle =
+                        portInputRegister(digitalPinToPort(data_pin));
+                ToggleRegister clk_toggle =
+                        portInputRegister(digitalPinToPort(clk_pin));
+                const uint8_t data_mask = digitalPinToBitMask(data_pin);
+                const uint8_t clk_mask = digitalPinToBitMask(clk_pin);
+
+                uint8_t level = *portOutputRegister(digitalPinToPort(data_pin))
+                        & data_mask ? 1 : 0;
+
+                // this is how the DotStar class stores brightness: one more
+                // than what you set, so that 0 means don't scale at all
+                const uint8_t scale = strip.getBrightness() + 1;
+                const uint16_t nr_leds = strip.numPixels();
+                const uint8_t *pixels = strip.getPixels();
+
+                for (uint8_t i = 0; i < 4; ++i)
+                        byteOut(data_toggle, data_mask, clk_toggle, clk_mask,
+                                level, 0);
+
+                for (uint16_t i = 0; i < nr_leds; ++i) {
+                        byteOut(data_toggle, data_mask, clk_toggle, clk_mask,
+                                level, 0xff);
+                        for (uint8_t j = 0; j < 3; ++j, ++pixels) {
+                                uint8_t b = scale ? (*pixels * (uint16_t)scale) >> 8
+                                        : *pixels;
+                                byteOut(data_toggle, data_mask, clk_toggle,
+                                        clk_mask, level, b);
+                        }
+                }
+
+                for (uint16_t i = 0; i < (nr_leds + 15) / 16; ++i)
+                        byteOut(data_toggle, data_mask, clk_toggle, clk_mask,
+                                level, 0xff);
+        }
+};
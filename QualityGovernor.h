@@ -0,0 +1,89 @@
+// QualityGovernor.h
+//
+// Keeps programs inside their frame deadline. After every frame we compare
+// what the frame cost against the interval it had; if frames keep missing
+// the deadline the program is asked to drop a quality level (see
+// LedProgram::nrQualityLevels()), and if they keep coming in well under it
+// the program gets a level back. The thresholds are far enough apart, and
+// each step needs a run of frames, so we don't flap between two levels.
+
+#pragma once
+
+#include "LedProgram.h"
+
+class QualityGovernor
+{
+private:
+        // this many missed deadlines in a row and we step down
+        static constexpr uint8_t MISSES_TO_STEP_DOWN_ = 2;
+        // this many frames in a row under UNDER_PERCENT_ of the deadline and
+        // we step back up
+        static constexpr uint8_t FRAMES_TO_STEP_UP_ = 30;
+        static constexpr uint8_t UNDER_PERCENT_ = 60;
+
+        LedProgram *prog_ = NULL;
+        uint8_t level_ = 0;
+        uint8_t misses_in_a_row_ = 0;
+        uint8_t fast_in_a_row_ = 0;
+        uint32_t misses_ = 0;
+
+public:
+        // call at the start of every frame with the program that's running.
+        // A new program starts at full quality.
+        void frameStarted(LedProgram *prog)
+        {
+                if (prog == prog_)
+                        return;
+
+                prog_ = prog;
+                level_ = 0;
+                misses_in_a_row_ = 0;
+                fast_in_a_row_ = 0;
+                prog_->setQuality(level_);
+        }
+
+        // call at the end of every frame with what it cost and what it was
+        // allowed to cost
+        void frameDone(const uint32_t cost_micros, const uint32_t deadline_micros)
+        {
+                if (!prog_)
+                        return;
+
+                if (cost_micros > deadline_micros) {
+                        ++misses_;
+                        fast_in_a_row_ = 0;
+                        if (++misses_in_a_row_ < MISSES_TO_STEP_DOWN_)
+                                return;
+
+                        misses_in_a_row_ = 0;
+                        if (level_ + 1 < prog_->nrQualityLevels())
+                                prog_->setQuality(++level_);
+                        return;
+                }
+
+                misses_in_a_row_ = 0;
+                if (cost_micros > deadline_micros / 100 * UNDER_PERCENT_) {
+                        fast_in_a_row_ = 0;
+                        return;
+                }
+
+                if (++fast_in_a_row_ < FRAMES_TO_STEP_UP_)
+                        return;
+
+                fast_in_a_row_ = 0;
+                if (level_ > 0)
+                        prog_->setQuality(--level_);
+        }
+
+        // the current program's quality level, 0 being the best
+        uint8_t level() const
+        {
+                return level_;
+        }
+
+        // total missed deadlines
+        uint32_t misses() const
+        {
+                return misses_;
+        }
+};
@@ -0,0 +1,59 @@
+// RamMonitor.h
+//
+// RAM high water mark. At startup we paint all the free RAM between the heap
+// and the stack with a pattern; later, however much of the pattern is still
+// intact is how close the stack (or heap) has ever come to running into the
+// other. On a board with 8K of RAM and a 432 byte strip buffer, that's worth
+// keeping an eye on.
+
+#pragma once
+
+#include <Arduino.h>
+
+extern char __heap_start;
+extern char *__brkval;
+
+class RamMonitor
+{
+private:
+        static constexpr uint8_t PAINT_ = 0xa5;
+
+        // leave this much below the stack pointer alone when painting, for
+        // the stack frames of paint() itself and any interrupts that come in
+        static constexpr uint8_t MARGIN_ = 64;
+
+        static char *heapEnd()
+        {
+                return __brkval ? __brkval : &__heap_start;
+        }
+
+public:
+        // call this as early as possible, from setup()
+        static void paint()
+        {
+                char *p = heapEnd();
+                char *end = (char *)SP - MARGIN_;
+                noInterrupts();
+                while (p < end)
+                        *p++ = PAINT_;
+                interrupts();
+        }
+
+        // bytes between the heap and the stack that have never been touched
+        // since paint()
+        static uint16_t neverUsed()
+        {
+                const char *p = heapEnd();
+                const char *end = (const char *)SP;
+                uint16_t n = 0;
+                while (p < end && *p++ == (char)PAINT_)
+                        ++n;
+                return n;
+        }
+
+        // bytes between the heap and the stack right now
+        static uint16_t freeNow()
+        {
+                return (const char *)SP - heapEnd();
+        }
+};
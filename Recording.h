@@ -0,0 +1,352 @@
+// Recording.h
+//
+// Recording every strip we send, along with the inputs that produced it, and
+// playing such a recording back.
+//
+// RecordingOutput is an LedOutput that writes each strip to a Stream as a
+// record. Capture that stream on a computer and you have a file that can be
+// indexed (every record starts with a magic number and a fixed size header),
+// looked at offline, or sent back to the board, where RecordingPlayer shows
+// it again bit for bit.
+//
+// A record is (multi-byte fields are big endian):
+//
+//   offset  size  field
+//   0       2     magic, 'L' 'M'
+//   2       4     frame number
+//   6       4     millis() when the frame started
+//   10      1     strip number
+//   11      1     strip brightness, as Adafruit_DotStar::getBrightness()
+//   12      1     program number (the rotary encoder position)
+//   13      2     frequency pot reading
+//   15      2     brightness pot reading
+//   17      2     number of pixels
+//   19      ...   pixels
+//
+// The pixels are the strip buffer as the DotStar class holds it (i.e. in the
+// strip's color order), delta coded against the same byte of the previous
+// pixel and then PackBits run length encoded. Every record stands on its own,
+// so you can start reading at any record. Most programs fill strips with one
+// color, and those compress down to a handful of bytes.
+
+#pragma once
+
+#include "LedOutput.h"
+#include "LiveInput.h"
+
+#include <Adafruit_DotStar.h>
+
+namespace recording {
+
+static constexpr uint8_t MAGIC_0 = 'L';
+static constexpr uint8_t MAGIC_1 = 'M';
+static constexpr uint8_t HEADER_SIZE = 19;
+
+// PackBits: a control byte n in [0, 127] is followed by n + 1 literal bytes,
+// n in [-127, -1] is followed by one byte to be repeated 1 - n times, and
+// -128 is a no-op.
+static constexpr uint8_t MAX_RUN = 128;
+static constexpr uint8_t MAX_LITERALS = 128;
+
+}
+
+class RecordingOutput : public LedOutput
+{
+private:
+        Stream& stream_;
+
+        // inputs for the current frame
+        uint32_t frame_ = 0;
+        uint32_t frame_millis_ = 0;
+        uint8_t prog_ = 0;
+        uint16_t freq_ = 0;
+        uint16_t brightness_ = 0;
+
+        // encoder state
+        uint8_t literals_[recording::MAX_LITERALS];
+        uint8_t nr_literals_ = 0;
+        uint8_t run_byte_ = 0;
+        uint8_t run_len_ = 0;
+
+        void write16(const uint16_t x)
+        {
+                stream_.write(x >> 8);
+                stream_.write(x & 0xff);
+        }
+
+        void write32(const uint32_t x)
+        {
+                write16(x >> 16);
+                write16(x & 0xffff);
+        }
+
+        void flushLiterals()
+        {
+                if (nr_literals_ == 0)
+                        return;
+
+                stream_.write(nr_literals_ - 1);
+                stream_.write(literals_, nr_literals_);
+                nr_literals_ = 0;
+        }
+
+        void addLiteral(const uint8_t b)
+        {
+                literals_[nr_literals_++] = b;
+                if (nr_literals_ == recording::MAX_LITERALS)
+                        flushLiterals();
+        }
+
+        // runs of 2 aren't worth breaking a literal run for
+        void flushRun()
+        {
+                if (run_len_ >= 3) {
+                        flushLiterals();
+                        stream_.write((uint8_t)(1 - run_len_));
+                        stream_.write(run_byte_);
+                } else {
+                        for (uint8_t i = 0; i < run_len_; ++i)
+                                addLiteral(run_byte_);
+                }
+                run_len_ = 0;
+        }
+
+        void encode(const uint8_t b)
+        {
+                if (run_len_ != 0 && b == run_byte_ && run_len_ < recording::MAX_RUN) {
+                        ++run_len_;
+                        return;
+                }
+
+                flushRun();
+                run_byte_ = b;
+                run_len_ = 1;
+        }
+
+public:
+        RecordingOutput(Stream& stream) : stream_{stream} {}
+
+        // call at the start of every frame with the inputs that frame is
+        // rendered from
+        void frameStarted(const uint8_t prog, const uint16_t freq,
+                          const uint16_t brightness)
+        {
+                ++frame_;
+                frame_millis_ = millis();
+                prog_ = prog;
+                freq_ = freq;
+                brightness_ = brightness;
+        }
+
+        void show(Adafruit_DotStar& strip, const uint8_t strip_nr)
+        {
+                const uint16_t nr_pixels = strip.numPixels();
+                const uint16_t nr_bytes = 3*nr_pixels;
+                const uint8_t *pixels = strip.getPixels();
+
+                stream_.write(recording::MAGIC_0);
+                stream_.write(recording::MAGIC_1);
+                write32(frame_);
+                write32(frame_millis_);
+                stream_.write(strip_nr);
+                stream_.write(strip.getBrightness());
+                stream_.write(prog_);
+                write16(freq_);
+                write16(brightness_);
+                write16(nr_pixels);
+
+                for (uint16_t i = 0; i < nr_bytes; ++i)
+                        encode(i < 3 ? pixels[i] : pixels[i] - pixels[i - 3]);
+                flushRun();
+                flushLiterals();
+        }
+};
+
+// plays back what RecordingOutput wrote. Records are decoded a byte at a time
+// as they come in, straight into the strip buffer, so like OpcReceiver this
+// is busy() from a record's header until it's shown or given up on. A record
+// for a strip we haven't got is decoded into thin air and dropped.
+class RecordingPlayer : public LiveInput
+{
+private:
+        // if a record stops half way through for this long, we give up on it
+        // and look for the next magic number
+        static constexpr unsigned long RESYNC_MILLIS_ = 100;
+
+        // upper bound on how much input one call to poll() will eat, so that
+        // a flood of data can't stall loop()
+        static constexpr uint16_t MAX_BYTES_PER_POLL_ = 128;
+
+        Stream& stream_;
+        const uint8_t nr_strips_;
+
+        uint8_t header_[recording::HEADER_SIZE];
+        uint8_t header_pos_ = 0;
+
+        // payload state. remaining_ counts decoded bytes still to come.
+        bool in_payload_ = false;
+        bool discard_ = false;
+        uint16_t pos_ = 0;
+        uint16_t remaining_ = 0;
+        uint8_t literals_left_ = 0;
+        uint8_t run_len_ = 0;
+
+        unsigned long last_data_millis_ = 0;
+        unsigned long arrival_micros_ = 0;
+
+        uint32_t records_ = 0;
+        uint32_t resyncs_ = 0;
+        uint32_t rejected_ = 0;
+
+        uint16_t read16(const uint8_t offset) const
+        {
+                return (uint16_t)header_[offset] << 8 | header_[offset + 1];
+        }
+
+        void reset()
+        {
+                header_pos_ = 0;
+                in_payload_ = false;
+                literals_left_ = 0;
+                run_len_ = 0;
+        }
+
+        // undo the delta coding and store one byte
+        void put(Adafruit_DotStar& strip, const uint8_t delta)
+        {
+                if (!discard_ && pos_ < 3*strip.numPixels()) {
+                        uint8_t *pixels = strip.getPixels();
+                        pixels[pos_] = pos_ < 3 ? delta : delta + pixels[pos_ - 3];
+                }
+                ++pos_;
+                --remaining_;
+        }
+
+        // returns true if a record was shown
+        bool finishRecord(Adafruit_DotStar& strip, LedOutput& output)
+        {
+                const uint8_t strip_nr = header_[10];
+
+                if (discard_) {
+                        reset();
+                        return false;
+                }
+
+                strip.setBrightness(header_[11]);
+                output.show(strip, strip_nr);
+                shown(strip_nr, arrival_micros_);
+                ++records_;
+                reset();
+                return true;
+        }
+
+        bool startRecord(Adafruit_DotStar& strip, LedOutput& output)
+        {
+                in_payload_ = true;
+                pos_ = 0;
+                remaining_ = 3*read16(17);
+
+                // the output would index its pins with this
+                discard_ = header_[10] >= nr_strips_;
+                if (discard_)
+                        ++rejected_;
+                else
+                        // pixels past the end of the record are black
+                        memset(strip.getPixels(), 0, 3*strip.numPixels());
+
+                if (remaining_ == 0)
+                        return finishRecord(strip, output);
+                return false;
+        }
+
+public:
+        RecordingPlayer(Stream& stream, const uint8_t nr_strips)
+                : stream_{stream}, nr_strips_{nr_strips}
+        {}
+
+        bool poll(Adafruit_DotStar& strip, LedOutput& output)
+        {
+                bool any_shown = false;
+
+                // the sender went quiet half way through a record. Check
+                // every time rather than when the next byte turns up, which
+                // it may never do. If the record had started on the strip
+                // buffer, that's clobbered.
+                if ((header_pos_ != 0 || in_payload_)
+                    && millis() - last_data_millis_ > RESYNC_MILLIS_) {
+                        any_shown |= in_payload_ && !discard_;
+                        reset();
+                        ++resyncs_;
+                }
+
+                for (uint16_t n = 0; n < MAX_BYTES_PER_POLL_; ++n) {
+                        int c = stream_.read();
+                        if (c < 0)
+                                break;
+
+                        last_data_millis_ = millis();
+
+                        if (!in_payload_) {
+                                if (header_pos_ == 0)
+                                        arrival_micros_ = micros();
+
+                                // hunt for the magic number. "LLM" is an
+                                // 'L' too many and then a record.
+                                if (header_pos_ == 0 && c != recording::MAGIC_0)
+                                        continue;
+                                if (header_pos_ == 1 && c != recording::MAGIC_1) {
+                                        header_pos_ = c == recording::MAGIC_0;
+                                        arrival_micros_ = micros();
+                                        continue;
+                                }
+
+                                header_[header_pos_++] = c;
+                                if (header_pos_ == recording::HEADER_SIZE)
+                                        any_shown |= startRecord(strip, output);
+                                continue;
+                        }
+
+                        if (literals_left_ != 0) {
+                                --literals_left_;
+                                put(strip, c);
+                        } else if (run_len_ != 0) {
+                                for (; run_len_ != 0 && remaining_ != 0; --run_len_)
+                                        put(strip, c);
+                                run_len_ = 0;
+                        } else if (c < 128) {
+                                literals_left_ = c + 1;
+                        } else if (c != 128) {
+                                run_len_ = 1 - (int8_t)c;
+                        }
+
+                        if (remaining_ == 0)
+                                any_shown |= finishRecord(strip, output);
+                }
+
+                return any_shown;
+        }
+
+        bool busy(const unsigned long now) const
+        {
+                (void)now;
+                return in_payload_ && !discard_;
+        }
+
+        // records shown
+        uint32_t records() const
+        {
+                return records_;
+        }
+
+        // records dropped because they stopped half way through
+        uint32_t resyncs() const
+        {
+                return resyncs_;
+        }
+
+        // records dropped because they were for a strip we haven't got
+        uint32_t rejected() const
+        {
+                return rejected_;
+        }
+};
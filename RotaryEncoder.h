@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include "ScopeMarker.h"
+#include "StageProfiler.h"
+
 #include <Adafruit_LEDBackpack.h>
 
 class RotaryEncoder
@@ -30,6 +33,8 @@ private:
 
         static void pin_isr()
         {
+                ScopeMarker<SCOPE_ENCODER_ISR> mark;
+                ProfileStage stage{StageProfiler::ENCODER_ISR};
                 RotaryEncoder *enc = instance_;
 
                 bool change = false;
@@ -136,6 +141,15 @@ public:
         
         // XXX: consider copy construction and assignment
 
+        // carry on counting from index, e.g. where we were before a power
+        // cycle
+        void setIndex(const uint8_t index)
+        {
+                noInterrupts();
+                rotary_index_ = index;
+                interrupts();
+        }
+
         uint8_t getIndex()
         {
                 uint8_t index;
@@ -0,0 +1,69 @@
+// ScopeMarker.h
+//
+// Marker pins for timing hot paths on a scope. Each marker is a spare pin
+// that goes high at the start of a stage and low at the end, using single
+// instruction port writes (sbi/cbi), so unlike Serial prints they don't
+// perturb what they measure.
+//
+// The markers are on port A, i.e. pins 22-25:
+//
+//   pin 22: frame, from startFrame() to finishFrame()
+//   pin 23: render, LedProgram::updateStrip()
+//   pin 24: transmit, LedOutput::show()
+//   pin 25: RotaryEncoder::pin_isr()
+//
+// They only exist if LED_MONGER_SCOPE_MARKERS is defined before this is
+// included (see the top of led_monger.ino); otherwise all of this compiles to
+// nothing. test/scope_marker_test.cpp turns them on on a computer and logs
+// the pulses, which "scope_marker_test -v" prints.
+
+#pragma once
+
+#include <Arduino.h>
+
+enum ScopeMarkerBit : uint8_t {
+        SCOPE_FRAME = 0,
+        SCOPE_RENDER = 1,
+        SCOPE_SHOW = 2,
+        SCOPE_ENCODER_ISR = 3
+};
+
+template <uint8_t Bit>
+class ScopeMarker
+{
+public:
+        static void high()
+        {
+#ifdef LED_MONGER_SCOPE_MARKERS
+                PORTA |= _BV(Bit);
+#endif
+        }
+
+        static void low()
+        {
+#ifdef LED_MONGER_SCOPE_MARKERS
+                PORTA &= ~_BV(Bit);
+#endif
+        }
+
+        // or mark the enclosing scope
+        ScopeMarker()
+        {
+                high();
+        }
+
+        ~ScopeMarker()
+        {
+                low();
+        }
+};
+
+static inline void beginScopeMarkers()
+{
+#ifdef LED_MONGER_SCOPE_MARKERS
+        PORTA &= ~(_BV(SCOPE_FRAME) | _BV(SCOPE_RENDER) | _BV(SCOPE_SHOW)
+                   | _BV(SCOPE_ENCODER_ISR));
+        DDRA |= _BV(SCOPE_FRAME) | _BV(SCOPE_RENDER) | _BV(SCOPE_SHOW)
+                | _BV(SCOPE_ENCODER_ISR);
+#endif
+}
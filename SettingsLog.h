@@ -0,0 +1,181 @@
+// SettingsLog.h
+//
+// Keeps the settings we'd want back after a power cycle (which program we're
+// on and the console overrides) in EEPROM, so the lights come back up the way
+// they were left.
+//
+// EEPROM cells are good for about 100,000 writes, and the encoder can go
+// through a dozen programs in a second. So settings are only saved once
+// they've stopped changing for a while, and each save goes to the next slot of
+// a ring of slots, rather than rewriting the same bytes every time. On boot,
+// the valid slot with the highest sequence number wins.
+//
+// An EEPROM byte write takes 3.3ms, so a save is written one byte per call to
+// update(), and only when the EEPROM isn't busy with the last byte; update()
+// never waits. A slot's magic byte is cleared first and written last, so if
+// the power goes out half way through a save, that slot just isn't valid and
+// the previous save is what we come back up with.
+
+#pragma once
+
+#include <Arduino.h>
+#include <avr/eeprom.h>
+
+struct Settings
+{
+        uint8_t prog;
+        int16_t freq_override;
+        int16_t brightness_override;
+        uint8_t telemetry;
+};
+
+class SettingsLog
+{
+private:
+        // where the ring lives in EEPROM, and how big it is. The Mega has 4K
+        // of EEPROM, and this takes the first 1K.
+        static constexpr uint16_t BASE_ = 0;
+        static constexpr uint8_t SLOT_SIZE_ = 16;
+        static constexpr uint8_t NR_SLOTS_ = 64;
+
+        static constexpr uint8_t MAGIC_ = 0x5e;
+
+        // how long settings have to stay put before we save them
+        static constexpr unsigned long SETTLE_MILLIS_ = 5000;
+
+        struct Record
+        {
+                uint8_t magic;
+                uint16_t seq;
+                Settings settings;
+                uint8_t check;
+        };
+
+        static_assert(sizeof(Record) <= SLOT_SIZE_, "settings don't fit in a slot");
+
+        // the slot the newest record is in, and its sequence number
+        uint8_t slot_ = NR_SLOTS_ - 1;
+        uint16_t seq_ = 0;
+
+        // the settings as of the last change, and when that was
+        Settings wanted_;
+        unsigned long changed_millis_ = 0;
+        bool dirty_ = false;
+
+        // the record being written, and how far along we are. Byte 0 (the
+        // magic) is cleared first, then bytes 1 and up go out, then the
+        // magic goes out last.
+        Record pending_;
+        uint8_t *dst_ = NULL;
+        uint8_t write_pos_ = 0;
+        bool clearing_ = false;
+        bool writing_ = false;
+
+        uint32_t saves_ = 0;
+
+        static uint8_t *slotAddress(const uint8_t slot)
+        {
+                return (uint8_t *)(BASE_ + (uint16_t)slot * SLOT_SIZE_);
+        }
+
+        static uint8_t checksum(const Record& r)
+        {
+                const uint8_t *p = (const uint8_t *)&r;
+                uint8_t sum = 0;
+                for (uint8_t i = 0; i < offsetof(Record, check); ++i)
+                        sum = (sum << 1 | sum >> 7) ^ p[i];
+                return ~sum;
+        }
+
+        void startWrite()
+        {
+                slot_ = (slot_ + 1) % NR_SLOTS_;
+                ++seq_;
+
+                pending_.magic = MAGIC_;
+                pending_.seq = seq_;
+                pending_.settings = wanted_;
+                pending_.check = checksum(pending_);
+
+                dst_ = slotAddress(slot_);
+                write_pos_ = 0;
+                clearing_ = true;
+                writing_ = true;
+                dirty_ = false;
+        }
+
+        // write at most one byte, if the EEPROM is free
+        void writeSome()
+        {
+                if (!eeprom_is_ready())
+                        return;
+
+                const uint8_t *src = (const uint8_t *)&pending_;
+
+                if (clearing_) {
+                        eeprom_update_byte(dst_, 0);
+                        clearing_ = false;
+                        write_pos_ = 1;
+                } else if (write_pos_ < sizeof pending_) {
+                        eeprom_update_byte(dst_ + write_pos_, src[write_pos_]);
+                        ++write_pos_;
+                } else {
+                        eeprom_update_byte(dst_, src[0]);
+                        writing_ = false;
+                        ++saves_;
+                }
+        }
+
+public:
+        // find the newest valid record. Returns false, and leaves settings
+        // alone, if there isn't one (e.g. the first time we run).
+        bool load(Settings& settings)
+        {
+                bool found = false;
+
+                for (uint8_t i = 0; i < NR_SLOTS_; ++i) {
+                        if (eeprom_read_byte(slotAddress(i)) != MAGIC_)
+                                continue;
+
+                        Record r;
+                        eeprom_read_block(&r, slotAddress(i), sizeof r);
+                        if (r.check != checksum(r))
+                                continue;
+
+                        // sequence numbers wrap, and are never more than
+                        // NR_SLOTS_ apart
+                        if (found && (int16_t)(r.seq - seq_) <= 0)
+                                continue;
+
+                        found = true;
+                        slot_ = i;
+                        seq_ = r.seq;
+                        settings = r.settings;
+                }
+
+                wanted_ = settings;
+                return found;
+        }
+
+        // call often with the current settings. Saves them once they've
+        // settled, without ever blocking.
+        void update(const Settings& settings, const unsigned long now)
+        {
+                if (memcmp(&settings, &wanted_, sizeof settings) != 0) {
+                        wanted_ = settings;
+                        changed_millis_ = now;
+                        dirty_ = true;
+                }
+
+                if (writing_)
+                        writeSome();
+                else if (dirty_ && now - changed_millis_ >= SETTLE_MILLIS_)
+                        startWrite();
+        }
+
+        // how many times we've saved since boot
+        uint32_t saves() const
+        {
+                return saves_;
+        }
+};
@@ -0,0 +1,196 @@
+// StageProfiler.h
+//
+// Sampling profiler. Code marks which stage of the pipeline it's in with a
+// ProfileStage (a single byte store on the way in and out), and a timer
+// interrupt samples the current stage about a thousand times a second into a
+// histogram. Dump it to see where the time goes in a real frame, including
+// inside updateStrip() and the ISRs, which the micros() counters around
+// show() can't tell you.
+//
+// Code can also count what a stage worked through (pixels, say) with
+// count(), and then print() gives the stage's cost per item as well. The
+// counts and samples only mean anything together over the same stretch of
+// time, so reset() clears both.
+//
+// This uses timer 3, which nothing else in this project uses. (Timer 0 is
+// millis().) test/profiler_test.cpp runs it on a computer, ticking a fake
+// timer 3 by hand.
+
+#pragma once
+
+#include <Arduino.h>
+
+class StageProfiler
+{
+public:
+        enum Stage : uint8_t {
+                // in between everything, i.e. loop() has nothing to do
+                IDLE,
+                // polling the live inputs, and them showing strips
+                LIVE_INPUT,
+                // reading inputs and setting up a frame
+                FRAME_START,
+                // LedProgram::updateStrip()
+                RENDER,
+                // CompositeProg's base layer, inside RENDER
+                BASE,
+                // CompositeProg's overlay layer, inside RENDER
+                OVERLAY,
+                // blending layers, in CompositeProg
+                BLEND,
+                // checking whether a strip changed, in FrameTracker
+                FRAME_CHECK,
+                // sending a strip to the output
+                SHOW,
+                // the Serial debug prints
+                DEBUG_PRINT,
+                // RotaryEncoder::pin_isr()
+                ENCODER_ISR,
+                NR_STAGES
+        };
+
+private:
+        friend class ProfileStage;
+
+        static volatile uint8_t stage_;
+        static volatile uint32_t samples_[NR_STAGES];
+        // only touched outside ISRs, so not volatile
+        static uint32_t items_[NR_STAGES];
+
+        // one sample period, see begin()
+        static constexpr uint32_t NS_PER_SAMPLE_ = 251UL*4000;
+
+        // in flash, like the rest of the console's strings
+        static const __FlashStringHelper *name(const uint8_t stage)
+        {
+                switch (stage) {
+                case IDLE:
+                        return F("idle");
+                case LIVE_INPUT:
+                        return F("live_input");
+                case FRAME_START:
+                        return F("frame_start");
+                case RENDER:
+                        return F("render");
+                case BASE:
+                        return F("base");
+                case OVERLAY:
+                        return F("overlay");
+                case BLEND:
+                        return F("blend");
+                case FRAME_CHECK:
+                        return F("frame_check");
+                case SHOW:
+                        return F("show");
+                case DEBUG_PRINT:
+                        return F("debug_print");
+                case ENCODER_ISR:
+                default:
+                        return F("encoder_isr");
+                }
+        }
+
+public:
+        // start sampling
+        static void begin()
+        {
+                noInterrupts();
+                // CTC mode, clk/64, so 250kHz ticks. 251 ticks is about
+                // 996Hz: slightly off 1kHz so we don't beat against anything
+                // that runs off millis().
+                TCCR3A = 0;
+                TCCR3B = _BV(WGM32) | _BV(CS31) | _BV(CS30);
+                TCNT3 = 0;
+                OCR3A = 251 - 1;
+                TIMSK3 |= _BV(OCIE3A);
+                interrupts();
+        }
+
+        // called from the timer ISR
+        static void sample()
+        {
+                ++samples_[stage_];
+        }
+
+        // the current stage worked through n more items
+        static void count(const Stage stage, const uint16_t n)
+        {
+                items_[stage] += n;
+        }
+
+        static void reset()
+        {
+                noInterrupts();
+                for (uint8_t i = 0; i < NR_STAGES; ++i) {
+                        samples_[i] = 0;
+                        items_[i] = 0;
+                }
+                interrupts();
+        }
+
+        static void print(Print& out)
+        {
+                uint32_t samples[NR_STAGES];
+                uint32_t total = 0;
+
+                noInterrupts();
+                for (uint8_t i = 0; i < NR_STAGES; ++i)
+                        samples[i] = samples_[i];
+                interrupts();
+
+                for (uint8_t i = 0; i < NR_STAGES; ++i)
+                        total += samples[i];
+
+                out.print(F("profile samples="));
+                out.println(total);
+                if (total == 0)
+                        return;
+
+                for (uint8_t i = 0; i < NR_STAGES; ++i) {
+                        out.print(F("  "));
+                        out.print(name(i));
+                        out.print(F(": "));
+                        out.print(samples[i]);
+                        out.print(F(" ("));
+                        out.print((uint32_t)(100ULL * samples[i] / total));
+                        out.print(F("%)"));
+                        if (items_[i]) {
+                                out.print(F(" "));
+                                out.print((uint32_t)((uint64_t)NS_PER_SAMPLE_ *
+                                                     samples[i] / items_[i]));
+                                out.print(F("ns/item"));
+                        }
+                        out.println();
+                }
+        }
+};
+
+volatile uint8_t StageProfiler::stage_ = StageProfiler::IDLE;
+volatile uint32_t StageProfiler::samples_[StageProfiler::NR_STAGES];
+uint32_t StageProfiler::items_[StageProfiler::NR_STAGES];
+
+ISR(TIMER3_COMPA_vect)
+{
+        StageProfiler::sample();
+}
+
+// marks the enclosing scope as being in a stage. Scopes nest, so e.g. an
+// ISR that interrupts a render is counted as the ISR and then goes back to
+// being a render.
+class ProfileStage
+{
+private:
+        const uint8_t prev_;
+
+public:
+        ProfileStage(const StageProfiler::Stage stage)
+                : prev_{StageProfiler::stage_}
+        {
+                StageProfiler::stage_ = stage;
+        }
+
+        ~ProfileStage()
+        {
+                StageProfiler::stage_ = prev_;
+        }
+};
@@ -0,0 +1,80 @@
+// StripScheduler.h
+//
+// Splits each frame into one task per strip so that loop() never blocks for
+// a whole frame. Each call to loop() runs at most one strip, and between
+// frames loop() returns right away instead of sitting in delay().
+
+#pragma once
+
+#include <Arduino.h>
+
+template <uint8_t NrStrips>
+class StripScheduler
+{
+private:
+        unsigned long frame_start_ = 0;
+        unsigned long interval_ = 0;
+        uint8_t next_strip_ = NrStrips;
+        bool started_ = false;
+
+public:
+        // are we between frames?
+        bool idle() const
+        {
+                return next_strip_ >= NrStrips;
+        }
+
+        // is it time to start the next frame? If the last frame took longer
+        // than its interval this is true as soon as that frame finishes, so
+        // frame time is max(interval, total work) and never more.
+        bool due(const unsigned long now) const
+        {
+                return !started_ || now - frame_start_ >= interval_;
+        }
+
+        void beginFrame(const unsigned long now, const unsigned long interval)
+        {
+                frame_start_ = now;
+                interval_ = interval;
+                next_strip_ = 0;
+                started_ = true;
+        }
+
+        // the strip to work on next. Strips are always handed out in order,
+        // which LedProgram::updateStrip() relies on. Only call this when
+        // !idle().
+        uint8_t nextStrip()
+        {
+                return next_strip_++;
+        }
+
+        // move the frame clock by "by" millis, e.g. to stay in step with
+        // another board (see FrameSync.h). Only call this between frames.
+        // The last frame's start never moves past now, so the next frame
+        // can't come due by wrapping around.
+        void slew(const long by, const unsigned long now)
+        {
+                if (by > 0 && (unsigned long)by > now - frame_start_)
+                        frame_start_ = now;
+                else
+                        frame_start_ += by;
+        }
+
+        // carry on as if the last frame had started at frame_start. Only
+        // call this between frames.
+        void restart(const unsigned long frame_start)
+        {
+                frame_start_ = frame_start;
+                started_ = true;
+        }
+
+        unsigned long frameStart() const
+        {
+                return frame_start_;
+        }
+
+        unsigned long interval() const
+        {
+                return interval_;
+        }
+};
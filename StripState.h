@@ -0,0 +1,156 @@
+// StripState.h
+//
+// Somewhere for a program to keep a few bytes per strip.
+//
+// The strip buffer is clobbered between strips (see
+// LedProgram::updateStrip()), so a program that animates each strip
+// independently needs its own place to keep, say, each strip's phase.
+// StripStateProg<State, NrStrips> gives it one: an array of NrStrips States,
+// one after the other, sized at compile time and counted in the program's
+// static RAM like everything else. The engine zeroes the array whenever the
+// program becomes the running program (see LedProgram::activate()), so an
+// all zero State has to be a sensible start, e.g. "not set up yet".
+//
+// State must be plain data: it's cleared with memset, never constructed.
+
+#pragma once
+
+#include "LedProgram.h"
+
+#include <Adafruit_DotStar.h>
+
+template <class State, uint8_t NrStrips>
+class StripStateProg : public LedProgram
+{
+private:
+        State states_[NrStrips];
+
+protected:
+        // strip_nr must be less than NrStrips
+        State& state(const uint8_t strip_nr)
+        {
+                return states_[strip_nr];
+        }
+
+        static constexpr uint8_t nrStateStrips()
+        {
+                return NrStrips;
+        }
+
+public:
+        // programs that override this must call it
+        void activate()
+        {
+                memset(states_, 0, sizeof states_);
+        }
+};
+
+// every strip slowly breathes in and out, each in its own color and at its
+// own pace, and picks a new color and pace at the bottom of every breath.
+// Each strip's phase is moved on frame by frame at its current pace, so
+// where a strip is depends on every pace it has had since the program
+// started, which is why it has to be kept. The paces come from the strip
+// number and the breath count rather than random(), so that boards in step
+// (see FrameSync.h), which switch programs on the same frame, agree on them.
+struct BreatheState
+{
+        // where in the breath the strip is, a full breath is 65536
+        uint16_t phase;
+        // how fast the phase goes, 0 until the strip is set up
+        uint8_t rate;
+        // color, as an angle around the color wheel
+        uint8_t hue;
+        // breaths so far, to pick the next rate and hue from
+        uint8_t breaths;
+        // the clock when the phase was last moved on. The frame only
+        // needs to tell one frame from the next.
+        uint16_t frame;
+        uint32_t freq_sum;
+};
+
+template <uint8_t NrStrips>
+class BreatheProg : public StripStateProg<BreatheState, NrStrips>
+{
+private:
+        using Base = StripStateProg<BreatheState, NrStrips>;
+
+        static uint32_t hueColor(const uint8_t hue, const uint8_t v)
+        {
+                // the same red - green - blue wheel as SingleColorProg,
+                // scaled to v
+                uint8_t pos = hue;
+                uint8_t r, g, b;
+                if (pos < 85) {
+                        r = 255 - pos*3;
+                        g = pos*3;
+                        b = 0;
+                } else if (pos < 170) {
+                        pos -= 85;
+                        r = 0;
+                        g = 255 - pos*3;
+                        b = pos*3;
+                } else {
+                        pos -= 170;
+                        r = pos*3;
+                        g = 0;
+                        b = 255 - pos*3;
+                }
+
+                return Adafruit_DotStar::Color((r*(uint16_t)v) >> 8,
+                                               (g*(uint16_t)v) >> 8,
+                                               (b*(uint16_t)v) >> 8);
+        }
+
+        // a new rate and hue for the strip's next breath
+        static void pickPace(BreatheState& s, const uint8_t strip_nr)
+        {
+                const uint32_t h = Base::scramble((uint16_t)s.breaths << 8
+                                                  | strip_nr);
+                s.rate = 16 + (h >> 16) % 48;
+                s.hue = h >> 24;
+        }
+
+public:
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                if (strip_nr >= Base::nrStateStrips()) {
+                        LedProgram::fillStrip(strip, strip.Color(0, 0, 0));
+                        return;
+                }
+
+                BreatheState& s = Base::state(strip_nr);
+                const FrameClock& c = Base::clock();
+                if (s.rate == 0) {
+                        pickPace(s, strip_nr);
+                        s.phase = Base::scramble(strip_nr);
+                } else {
+                        // the breath moves on by rate * (1 + frequency/16)
+                        // each frame, so at full frequency a breath takes
+                        // about 16 frames
+                        const uint16_t frames = (uint16_t)c.frame - s.frame;
+                        const uint16_t before = s.phase;
+                        s.phase += s.rate*(frames + c.freq_sum/16
+                                           - s.freq_sum/16);
+
+                        // wrapped round, i.e. at the bottom of a breath
+                        if (s.phase < before) {
+                                ++s.breaths;
+                                pickPace(s, strip_nr);
+                        }
+                }
+                s.frame = c.frame;
+                s.freq_sum = c.freq_sum;
+
+                // triangle wave, through the gamma table
+                uint16_t t = s.phase < 32768 ? s.phase : 65535 - s.phase;
+                uint8_t v = gc_table[t >> 7];
+
+                LedProgram::fillStrip(strip, hueColor(s.hue, v));
+        }
+};
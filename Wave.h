@@ -0,0 +1,160 @@
+// Wave.h
+//
+// Waves and plasma: programs that move color along the strips rather than
+// filling each one with a single color.
+//
+// Everything runs on 16 bit phases, where 65536 is a full turn and overflow
+// is just going round again. The phases come from the frame clock (see
+// LedProgram::clock()), so boards in step show the same waves. A pixel's
+// color is a sine or two of its phase, and the sine is a 256 entry table in
+// flash, so the cost per pixel is a few adds and flash reads, with no
+// multiplies or floats. Each strip starts its phases where the previous
+// strip's left off, so the waves roll on across the whole table (in strip
+// order, see layout.h).
+
+#pragma once
+
+#include "LedProgram.h"
+
+#include <Adafruit_DotStar.h>
+#include <Arduino.h>
+
+namespace wave {
+
+// 128 + 127.5 sin(2 pi i / 256), rounded
+static const uint8_t SINE[256] PROGMEM = {
+        128, 131, 134, 137, 140, 143, 146, 149, 152, 155, 158, 162, 165, 167, 170, 173,
+        176, 179, 182, 185, 188, 190, 193, 196, 198, 201, 203, 206, 208, 211, 213, 215,
+        218, 220, 222, 224, 226, 228, 230, 232, 234, 235, 237, 238, 240, 241, 243, 244,
+        245, 246, 248, 249, 250, 250, 251, 252, 253, 253, 254, 254, 254, 255, 255, 255,
+        255, 255, 255, 255, 254, 254, 254, 253, 253, 252, 251, 250, 250, 249, 248, 246,
+        245, 244, 243, 241, 240, 238, 237, 235, 234, 232, 230, 228, 226, 224, 222, 220,
+        218, 215, 213, 211, 208, 206, 203, 201, 198, 196, 193, 190, 188, 185, 182, 179,
+        176, 173, 170, 167, 165, 162, 158, 155, 152, 149, 146, 143, 140, 137, 134, 131,
+        128, 124, 121, 118, 115, 112, 109, 106, 103, 100, 97, 93, 90, 88, 85, 82,
+        79, 76, 73, 70, 67, 65, 62, 59, 57, 54, 52, 49, 47, 44, 42, 40,
+        37, 35, 33, 31, 29, 27, 25, 23, 21, 20, 18, 17, 15, 14, 12, 11,
+        10, 9, 7, 6, 5, 5, 4, 3, 2, 2, 1, 1, 1, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 1, 2, 2, 3, 4, 5, 5, 6, 7, 9,
+        10, 11, 12, 14, 15, 17, 18, 20, 21, 23, 25, 27, 29, 31, 33, 35,
+        37, 40, 42, 44, 47, 49, 52, 54, 57, 59, 62, 65, 67, 70, 73, 76,
+        79, 82, 85, 88, 90, 93, 97, 100, 103, 106, 109, 112, 115, 118, 121, 124
+};
+
+// sine of a 16 bit phase, as 0-255. Only the top 8 bits count.
+static inline uint8_t sin8(const uint16_t phase)
+{
+        return pgm_read_byte(&SINE[phase >> 8]);
+}
+
+// a color wheel of three sines a third of a turn apart
+static inline uint32_t rainbow(const uint16_t phase)
+{
+        return Adafruit_DotStar::Color(sin8(phase),
+                                       sin8(phase + 21845),
+                                       sin8(phase + 43691));
+}
+
+}
+
+// a rainbow rolling along the table, two strips to the rainbow
+class RainbowWaveProg : public LedProgram
+{
+private:
+        // phase per pixel
+        static constexpr uint16_t DX_ = 65536/288;
+
+public:
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                // at full frequency, a turn every 16 frames or so
+                const uint16_t phase = -travelled(256, 4);
+
+                const uint16_t n = strip.numPixels();
+                uint16_t p = phase + strip_nr*n*DX_;
+                for (uint16_t i = 0; i < n; ++i) {
+                        strip.setPixelColor(i, wave::rainbow(p));
+                        p += DX_;
+                }
+        }
+};
+
+// the old demo effect: three sines of different wavelengths drifting past
+// each other, summed and turned into color. Two run along the strips, the
+// third across them, so neighbouring strips differ.
+class PlasmaProg : public LedProgram
+{
+private:
+        static constexpr uint16_t DX1_ = 65536/97;
+        static constexpr uint16_t DX2_ = 65536/61;
+        static constexpr uint16_t PER_STRIP_ = 65536/5;
+
+public:
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                const uint16_t phase1 = travelled(384, 3);
+                const uint16_t phase2 = -travelled(256, 2);
+                const uint16_t phase3 = travelled(128, 1);
+                // the colors themselves drift round the wheel, slowly
+                const uint16_t hue = travelled(64, 0) + clock().freq_sum/2;
+
+                const uint16_t n = strip.numPixels();
+                uint16_t p1 = phase1 + strip_nr*n*DX1_;
+                uint16_t p2 = phase2 + strip_nr*n*DX2_;
+                const uint8_t s3 = wave::sin8(phase3 + strip_nr*PER_STRIP_);
+
+                for (uint16_t i = 0; i < n; ++i) {
+                        // 0-765, spread over most of the wheel
+                        uint16_t sum = wave::sin8(p1) + wave::sin8(p2) + s3;
+                        strip.setPixelColor(i, wave::rainbow(hue + sum*85));
+                        p1 += DX1_;
+                        p2 += DX2_;
+                }
+        }
+};
+
+// slow swells of blue-green light, two trains of waves running opposite ways
+// along the table and adding up where they meet
+class SwellProg : public LedProgram
+{
+private:
+        static constexpr uint16_t DX1_ = 65536/180;
+        static constexpr uint16_t DX2_ = 65536/67;
+
+public:
+        void updateStrip(Adafruit_DotStar& strip,
+                         const uint8_t strip_nr,
+                         const uint16_t brightness,
+                         const uint16_t frequency)
+        {
+                (void)brightness;
+                (void)frequency;
+
+                const uint16_t phase1 = -travelled(256, 2);
+                const uint16_t phase2 = travelled(512, 3);
+
+                const uint16_t n = strip.numPixels();
+                uint16_t p1 = phase1 + strip_nr*n*DX1_;
+                uint16_t p2 = phase2 + strip_nr*n*DX2_;
+                for (uint16_t i = 0; i < n; ++i) {
+                        const uint16_t sum = wave::sin8(p1) + wave::sin8(p2);
+                        const uint8_t v = gc_table[sum >> 1];
+                        const uint32_t c = strip.Color(v/8, (v*3u) >> 2, v);
+                        strip.setPixelColor(i, c);
+                        p1 += DX1_;
+                        p2 += DX2_;
+                }
+        }
+};
@@ -0,0 +1,1457 @@
+// golden_hashes.h
+//
+// Known good hashes for GoldenCheck, a line per strip in the order it
+// renders them, each strip in segments of 16 pixels.
+//
+// Made by "make goldens" in test/, which renders programs.h on a
+// computer with avr-libc's random(). Don't edit it by hand, and only
+// remake it once a change in output has been checked by eye.
+
+#pragma once
+
+#include <Arduino.h>
+
+const uint16_t golden_hashes[] PROGMEM = {
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6, 0xF1C6,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD, 0x8DAD,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3, 0x6AB3,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624, 0x624,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09, 0x9B09,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B, 0x752B,
+        0x411D, 0x411D, 0xDD2A, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x1C92, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xDB19,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x8548,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xDB19,
+        0x411D, 0x411D, 0x2A5F, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x824F, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x277E, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x1C92, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x1C41, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x2A5F, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x67B1,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x2A5F, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xDD2A, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x9B1, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xB9A3,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x888F, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x1C41, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xB9A3, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x9B1, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xDB09, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x1C92, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x8548, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x67B1, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xD255, 0x411D, 0x411D,
+        0x824F, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0xDB09, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x824F, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x1C41, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x824F, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x16DF, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x2A5F,
+        0xCDE4, 0x277E, 0xB668, 0x411D, 0x6FD2, 0x80A5, 0x1E78, 0xDB09, 0xCDF4,
+        0x837B, 0xA1B0, 0x8FDA, 0xDD2A, 0xB9A3, 0xDD2A, 0xDA1E, 0xEEEC, 0xD255,
+        0xC397, 0x824F, 0x23B7, 0x824F, 0x62F3, 0x9B1, 0x1C41, 0x411D, 0x1C92,
+        0xC023, 0x74F8, 0x411D, 0x8548, 0xFC61, 0x389D, 0x6EFD, 0x411D, 0x4851,
+        0x8F09, 0xEBE7, 0x411D, 0xE379, 0xB05B, 0x16DF, 0xE4FF, 0x54ED, 0x411D,
+        0xDD2A, 0xDD2A, 0xA668, 0x4517, 0xAA77, 0x96E7, 0x411D, 0xBB49, 0x1C92,
+        0x437A, 0xDB09, 0x2AEB, 0x411D, 0x8FDA, 0x3838, 0xC5, 0x277E, 0xD5D3,
+        0xA4E3, 0x8B13, 0x411D, 0x411D, 0x54ED, 0xB41E, 0xE4FF, 0xC059, 0x67B1,
+        0xBD6A, 0x1C92, 0x1C41, 0xFCB2, 0x8FDA, 0x9586, 0xB9A3, 0x4C3C, 0xF96C,
+        0xE789, 0x8FDA, 0x411D, 0x128B, 0xC776, 0xBC1, 0xD8C7, 0x411D, 0x277E,
+        0xDD2A, 0x88D1, 0x411D, 0x411D, 0xCAE3, 0x16DF, 0x40C, 0x411D, 0x2547,
+        0x1186, 0xDF92, 0xD28A, 0xDF4, 0x9AD1, 0x67B1, 0xDB09, 0x2A5F, 0x16DF,
+        0x9586, 0xE42C, 0x41CE, 0x4DB0, 0x411D, 0xD58D, 0x4CDA, 0x277E, 0x824F,
+        0x8EAC, 0xD255, 0xBF80, 0xD255, 0x888F, 0x1C92, 0xFC6D, 0x9B1, 0x62F3,
+        0x7A22, 0x4851, 0xDB19, 0x74BA, 0x40C, 0x7D29, 0x8548, 0x888F, 0x824F,
+        0x60B6, 0x2A5F, 0xFE6B, 0xE340, 0x9B1, 0x824F, 0x3073, 0xD255, 0x411D,
+        0x2A5F, 0x411D, 0xDD2A, 0x411D, 0x6DFC, 0x1F26, 0xB33D, 0x7DF6, 0x8CCB,
+        0x277E, 0xBD6A, 0xBB49, 0x7AF1, 0x29FA, 0x411D, 0x1E78, 0x411D, 0x7764,
+        0x9586, 0x128B, 0xDB09, 0x1C41, 0xC023, 0x489E, 0x3AED, 0x277E, 0x4EBD,
+        0xDB09, 0xFCB2, 0xD255, 0x184B, 0x4B5C, 0xFDA5, 0x14B8, 0x2F1D, 0xB9A3,
+        0x411D, 0xB9A3, 0x4DFE, 0x8655, 0xDD2A, 0xC023, 0x128B, 0x128B, 0x2D6D,
+        0xDF4D, 0xB9A3, 0x4F99, 0x277E, 0xF10F, 0x411D, 0x3214, 0xB436, 0xCF3,
+        0x8686, 0xDC0E, 0x2A5F, 0xAE23, 0x5B31, 0x411D, 0x4851, 0xD255, 0xF4F9,
+        0x411D, 0x490, 0xB9A3, 0xD500, 0xDDF9, 0x8F88, 0x411D, 0xCE2A, 0x411D,
+        0xD58D, 0x9B1, 0x410D, 0x1C0E, 0xD255, 0x1C41, 0xD255, 0xDB09, 0x7D9D,
+        0x23A7, 0x22A0, 0x67B1, 0xBE42, 0x3A3E, 0xD255, 0x411D, 0xB9A3, 0x476,
+        0x9B1, 0x7095, 0x3AED, 0x66B6, 0x411D, 0xA77F, 0x888F, 0x411D, 0x4B83,
+        0x411D, 0x16DF, 0x80A5, 0x1600, 0x5E73, 0xFDB5, 0x62E3, 0x16DF, 0x184B,
+        0xFCB2, 0x8869, 0x472E, 0x411D, 0x1B46, 0x411D, 0x4CA0, 0xE4FF, 0x8597,
+        0x888F, 0x7509, 0x54ED, 0x411D, 0x4CA0, 0x411D, 0xB04B, 0xDB09, 0x184B,
+        0xD58D, 0x411D, 0xD245, 0x96F7, 0x7AF1, 0x411D, 0xD255, 0xF37F, 0x1C92,
+        0x824F, 0xD255, 0x2977, 0x411D, 0x888F, 0xA640, 0xEA91, 0x411D, 0xD7A3,
+        0xCBD7, 0x5983, 0x78AF, 0xDD2A, 0x976C, 0x80A5, 0x857B, 0x74F8, 0x5EBC,
+        0x8B3B, 0x860B, 0x23B7, 0x461A, 0xDF8F, 0xC023, 0x33A1, 0x411D, 0x15DE,
+        0xDAAC, 0x8D84, 0x411D, 0xE773, 0x96F7, 0xEB23, 0xE4FF, 0x328E, 0x1C92,
+        0x65D6, 0x8B13, 0x5ED6, 0x411D, 0x8544, 0xA22C, 0x5D99, 0xFE58, 0xF37F,
+        0xBCA8, 0x45D4, 0x2A5F, 0x8152, 0x764B, 0xED48, 0xEE61, 0x4B5C, 0x488E,
+        0xDDDD, 0x5F93, 0xB9A3, 0x16B4, 0xF4F9, 0xF5D6, 0x67B1, 0xF6F3, 0xBD6A,
+        0x5B31, 0x6E22, 0x81D3, 0xB5CD, 0x1C92, 0x9011, 0xB104, 0xFCB, 0x20C1,
+        0xC243, 0x56D4, 0xD9B1, 0xBF90, 0x2273, 0x1C41, 0x472E, 0xE9EB, 0x411D,
+        0x81EA, 0x8FDA, 0x1C41, 0xFCB2, 0xC776, 0xDF5A, 0x2079, 0x4C3C, 0xF96C,
+        0x4423, 0x165E, 0x411D, 0x79C9, 0x112F, 0x3073, 0x9E18, 0x2A5F, 0x7285,
+        0xC600, 0x7764, 0xD47A, 0x6357, 0x411D, 0xD58D, 0xA6B7, 0x6FD2, 0xA1A1,
+        0x564E, 0x4851, 0x50B, 0x2E59, 0xCD9E, 0x20A6, 0x41C2, 0x1BC7, 0x824F,
+        0x4B5, 0xFEC4, 0xB385, 0xB9A3, 0x148, 0x824F, 0xA4E3, 0xBF4, 0x92B2,
+        0x9E18, 0x821D, 0x705B, 0xDA1E, 0x400A, 0x16DF, 0x3EF7, 0x254B, 0x824F,
+        0x1C41, 0x7612, 0x8686, 0x9B1, 0x1AC0, 0x1061, 0xE991, 0xDF4B, 0x128B,
+        0xF6FF, 0xE2CB, 0x40C, 0x411D, 0xC776, 0xC10C, 0x76D7, 0x5E73, 0x16DF,
+        0x4C3C, 0xBD6A, 0xBB49, 0x7AF1, 0xF56, 0x1F26, 0xEC58, 0x7DF6, 0x1F83,
+        0xF92, 0xAF24, 0x4841, 0x1C41, 0xCA62, 0x489E, 0x6F48, 0x1D2, 0x1332,
+        0xDF4D, 0xB9A3, 0x4DFE, 0xDF03, 0x6D38, 0xE68F, 0xA810, 0x5A27, 0x6083,
+        0x8686, 0x2991, 0x1F37, 0x95CF, 0xC706, 0x888F, 0x4851, 0x3B01, 0xF4F9,
+        0x8B64, 0x9586, 0x1B95, 0xF3AC, 0xC0F0, 0x1CF9, 0x67B1, 0xC467, 0x824F,
+        0xB331, 0x1C92, 0x1F5C, 0xDE5B, 0xAE91, 0xFCB2, 0xDB09, 0x3C0D, 0xA6F,
+        0xFDA5, 0x97E1, 0x4D73, 0x3A3E, 0x888F, 0xA5E4, 0x8BDC, 0x4E4A, 0xD754,
+        0x687C, 0xF018, 0x411D, 0x1C92, 0xD601, 0xD868, 0xFE17, 0x1AA1, 0x2E45,
+        0xB737, 0x6A0C, 0x67A1, 0x8813, 0xF4F9, 0x8F09, 0xD255, 0x23B7, 0x38F6,
+        0x9B1, 0x2757, 0x6762, 0x9EBC, 0x3FC, 0x3D7B, 0xE3DD, 0x16DF, 0x12D5,
+        0x3520, 0xAEC5, 0x1A72, 0x8548, 0xEE45, 0x67B1, 0xBDF6, 0x7EEB, 0x1F93,
+        0xD58D, 0xABAF, 0xA105, 0x96F7, 0xCAE3, 0x411D, 0x81D3, 0xF37F, 0x497E,
+        0x9AAB, 0x2A5F, 0x8EAC, 0x4CDA, 0x888F, 0xB5FF, 0xEB86, 0x401A, 0x8F09,
+        0x50B, 0x1AC0, 0x54ED, 0x277E, 0x67B1, 0x7DD3, 0xDA0F, 0xB09, 0x97F0,
+        0xF4F9, 0x411D, 0x3164, 0x4629, 0xC5A2, 0x35AD, 0x5B85, 0x2AEB, 0x67B1,
+        0xFEC4, 0x23A7, 0x73E3, 0xE9DE, 0x4B83, 0xCC89, 0x8C14, 0x2E55, 0xFCB2,
+        0xA0A8, 0xA0A8, 0xF4E5, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x9D46, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x4B7E,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x6835,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x4B7E,
+        0xA0A8, 0xA0A8, 0xFA1, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x88A6, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xC0B8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x9D46, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0x97A0, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xFA1, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xE5E3,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xFA1, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xF4E5, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x4816, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xAD1E,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xADEA, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x97A0, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xAD1E, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x4816, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xB108, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x9D46, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x6835, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xE5E3, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x141F, 0xA0A8, 0xA0A8,
+        0x88A6, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xB108, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0x88A6, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0x97A0, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0x88A6, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0x8C3E, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8,
+        0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xA0A8, 0xFA1,
+        0x8A85, 0x7E46, 0x6742, 0x9B09, 0x69A7, 0x1FB9, 0x162E, 0x6835, 0x58AE,
+        0x3683, 0xE65F, 0xD6ED, 0x11F9, 0x6144, 0x11F9, 0x5101, 0x29F9, 0xD8AD,
+        0x5CD2, 0x9CDE, 0x9278, 0x8A4B, 0xFA53, 0x8CE8, 0xEB78, 0x9B09, 0x9549,
+        0xDB57, 0xDAC5, 0x9B09, 0x9D64, 0x25D2, 0x211A, 0xF358, 0x9B09, 0xF9BA,
+        0xA8DC, 0x6902, 0x9B09, 0x755F, 0xCCA5, 0x76DD, 0x1135, 0xFC99, 0x9B09,
+        0x11F9, 0x11F9, 0x4FF8, 0xCDB8, 0x5D28, 0x146C, 0x9B09, 0xF4B6, 0x9549,
+        0xAB92, 0x6835, 0x22E0, 0x9B09, 0xD6ED, 0xF593, 0x4D90, 0x7E46, 0xBCC7,
+        0x963C, 0x2C46, 0x9B09, 0x9B09, 0xFC99, 0x4C02, 0x1135, 0xA7C3, 0x91EB,
+        0x8D7A, 0x9549, 0xEB78, 0x5BE3, 0xD6ED, 0x618, 0x6144, 0x8FD, 0x8EE9,
+        0xF35A, 0xD6ED, 0x9B09, 0xEDA1, 0xC10C, 0x4C68, 0x9324, 0x9B09, 0x7E46,
+        0x11F9, 0x17EE, 0x9B09, 0x9B09, 0x8B3F, 0x76DD, 0xA1AE, 0x9B09, 0x8310,
+        0xBAAA, 0x897F, 0x70B0, 0xC4F, 0xBEAC, 0x91EB, 0x6835, 0xEDB2, 0x76DD,
+        0x618, 0x7991, 0xE538, 0xAD4B, 0x9B09, 0x710A, 0xCADB, 0x7E46, 0x9CDE,
+        0xB57A, 0xD8AD, 0x1888, 0xD8AD, 0xCCB6, 0x9549, 0xF3FE, 0x8CE8, 0xFA53,
+        0xE37, 0xF9BA, 0xBA1E, 0x59A, 0xA1AE, 0xCF34, 0x9D64, 0xCCB6, 0x9CDE,
+        0x9051, 0xEDB2, 0x99C6, 0x1F64, 0x8CE8, 0x9CDE, 0x7C3F, 0xD8AD, 0x9B09,
+        0xEDB2, 0x9B09, 0x11F9, 0x9B09, 0x727F, 0x12CC, 0xFCE1, 0x6729, 0x85E1,
+        0x7E46, 0x8D7A, 0xF4B6, 0x7006, 0x71EC, 0x9B09, 0x162E, 0x9B09, 0x3A35,
+        0x618, 0xEDA1, 0x6835, 0xEB78, 0xDB57, 0x838C, 0xE19A, 0x7E46, 0xFA40,
+        0x6835, 0x5BE3, 0xD8AD, 0xBDC9, 0xAEB1, 0x62D7, 0x4646, 0x860A, 0x6144,
+        0x9B09, 0x6144, 0xB2AD, 0x1844, 0x11F9, 0xDB57, 0xEDA1, 0xEDA1, 0x468A,
+        0x2162, 0x6144, 0x8236, 0x7E46, 0x76A5, 0x9B09, 0x4CA4, 0x3DE2, 0xE750,
+        0x6675, 0x698F, 0xEDB2, 0xC654, 0xA84, 0x9B09, 0xF9BA, 0xD8AD, 0xD24F,
+        0x9B09, 0x1F1C, 0x6144, 0xC2F6, 0x6FC8, 0xCD0C, 0x9B09, 0x7194, 0x9B09,
+        0x710A, 0x8CE8, 0x4922, 0x3D6E, 0xD8AD, 0xEB78, 0xD8AD, 0x6835, 0x66,
+        0x4053, 0xAB4C, 0x91EB, 0xB44D, 0x9FAB, 0xD8AD, 0x9B09, 0x6144, 0xDD3A,
+        0x8CE8, 0x2B82, 0xE19A, 0x7AF4, 0x9B09, 0x76CC, 0xCCB6, 0x9B09, 0x6AC,
+        0x9B09, 0x76DD, 0x1FB9, 0xDEC0, 0x613C, 0xB0FC, 0x2878, 0x76DD, 0xBDC9,
+        0x5BE3, 0xE90, 0x30EE, 0x9B09, 0xEAC2, 0x9B09, 0xB64F, 0x1135, 0x3579,
+        0xCCB6, 0x21D7, 0xFC99, 0x9B09, 0xB64F, 0x9B09, 0x1E8E, 0x6835, 0xBDC9,
+        0x710A, 0x9B09, 0xA86, 0xC647, 0x7006, 0x9B09, 0xD8AD, 0xB625, 0x9549,
+        0x9CDE, 0xD8AD, 0xC210, 0x9B09, 0xCCB6, 0x3E18, 0xA95, 0x9B09, 0x7C47,
+        0x3509, 0xA10D, 0xD20, 0x53EE, 0x6B50, 0x7299, 0xDFA9, 0xFCB2, 0xCDBC,
+        0xF8B4, 0x158D, 0x2712, 0x84BC, 0x1F5B, 0xB0F0, 0x8C8D, 0x752B, 0xB7F7,
+        0x466B, 0x8523, 0x752B, 0xFC5E, 0x728C, 0xDEA6, 0x330D, 0x2D76, 0x545C,
+        0xCE48, 0x5849, 0xC268, 0x752B, 0x47CA, 0x9642, 0x4600, 0xB344, 0xB0CC,
+        0x4B78, 0x32E9, 0x4145, 0x468C, 0xAFC1, 0xD094, 0x6B4C, 0x6BEE, 0xD004,
+        0x63B8, 0x6C47, 0xB2B5, 0x5271, 0xA549, 0x4B2, 0xEE9E, 0x8F0E, 0x2358,
+        0x309, 0x4BB1, 0x74B1, 0x2F76, 0x545C, 0x7EE7, 0x68B4, 0x7BAB, 0x1904,
+        0x9563, 0xBACD, 0x86DE, 0x3C0C, 0xBB00, 0xF493, 0xFB92, 0x4EAD, 0x752B,
+        0xCECF, 0x1F8B, 0xF493, 0x91CB, 0x5BA, 0x4BA6, 0x4768, 0x8291, 0xEAD4,
+        0x6FC, 0x48C0, 0x752B, 0x36D3, 0xBB3C, 0x3767, 0xC3F2, 0x4145, 0x3B69,
+        0x392, 0xE3A, 0x6BD5, 0xCE4, 0x752B, 0x5FC0, 0x4372, 0xACCE, 0xA866,
+        0x800A, 0x9680, 0x817C, 0xABF7, 0x89BF, 0x1EC, 0x33AF, 0xE116, 0x8639,
+        0xF94E, 0x7DB1, 0xB498, 0xB2B5, 0x178D, 0x8639, 0x1D8C, 0xFD48, 0x104F,
+        0xC3F2, 0x14CB, 0x628B, 0xA7E, 0x9FD9, 0xACD2, 0x882B, 0xD2F4, 0x8639,
+        0xF493, 0xDE3D, 0xC1FB, 0x6F1A, 0x363F, 0x2032, 0xAA8D, 0x870A, 0x2BD,
+        0x6945, 0xB8F1, 0x807A, 0x752B, 0x5BA, 0x110B, 0xB71B, 0xB6E3, 0xACD2,
+        0x8291, 0x2358, 0x903A, 0x9788, 0x4429, 0x629, 0x3F23, 0x661F, 0x72A2,
+        0xDC78, 0xE65D, 0xAB5B, 0xF493, 0xAE35, 0xEDDF, 0x9609, 0x2D4A, 0xA9E5,
+        0x7338, 0xB2B5, 0xEAB1, 0x3A5A, 0x8E41, 0x2B45, 0xBFCD, 0x188C, 0x433C,
+        0xC1FB, 0xF710, 0xCA85, 0xD3D7, 0x25CC, 0xAAC1, 0x9680, 0x53C9, 0xA549,
+        0xAB55, 0x49DF, 0xA5CB, 0x1003, 0x103F, 0x7CD0, 0xEE9E, 0x2344, 0x8639,
+        0xDA90, 0x8273, 0x3426, 0x68BD, 0x7D61, 0x91CB, 0xE08C, 0x4150, 0x32BB,
+        0x7B39, 0x6909, 0x3EC7, 0xCFE9, 0xAAC1, 0xCAA5, 0x2316, 0x6EEB, 0x367,
+        0xCF99, 0x4276, 0x752B, 0x545C, 0x9093, 0xE604, 0xDD7E, 0xDAE5, 0xA648,
+        0x3022, 0xD7D1, 0xD345, 0xB21B, 0xA549, 0xBF44, 0x3EFC, 0x2712, 0x89CD,
+        0x6F1A, 0x315A, 0x4E51, 0x460E, 0x9794, 0x4778, 0xA374, 0xACD2, 0x7604,
+        0x4E21, 0xCD8E, 0x7A2A, 0xA181, 0x2DFA, 0xEE9E, 0xEDAD, 0xA6AA, 0x4F79,
+        0x5FC0, 0xEB6, 0x2D9A, 0x728C, 0x4A27, 0x752B, 0x74B1, 0xB0CC, 0xE154,
+        0xB63F, 0x4145, 0x19A3, 0x7E6B, 0xAAC1, 0xA029, 0xAA2D, 0xA202, 0xBF44,
+        0x817C, 0x363F, 0xEEA2, 0xB6FF, 0xEE9E, 0xD1DE, 0xC6D2, 0x948, 0xA5A5,
+        0xA549, 0x752B, 0xDD95, 0x2CBB, 0x4E21, 0x9A57, 0xBB2E, 0xF962, 0xEE9E,
+        0x7DB1, 0x1AC9, 0xD6B5, 0xC4B7, 0x2D6A, 0x634D, 0x7FF1, 0x9B93, 0x91CB,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0xAFED, 0x1FF2, 0x2042, 0x50DB, 0x588C,
+        0xD832, 0x16FE, 0x4BB1, 0x99B, 0x32DD, 0x1FA7, 0x6235, 0xF2CE, 0xFC0B,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x1FF2, 0x5A6C, 0x92E2, 0xD68B,
+        0x66D, 0xC7B1, 0x5796, 0xFC4F, 0x711F, 0x451B, 0x2C6, 0x3F5B, 0x873F,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x6778, 0x1FF2, 0x1942, 0xFF00,
+        0x782A, 0x1AD4, 0x96CD, 0x882D, 0x3649, 0xB519, 0xB463, 0x4813, 0x7711,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xC150, 0x1FF2, 0x7D47, 0x76FC,
+        0x5D58, 0x230E, 0x69D4, 0xCCB3, 0xA444, 0x4088, 0x2368, 0xB38E, 0xBF99,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xF17D, 0x1FF2, 0x1FF2,
+        0xB255, 0xA2E0, 0x7D02, 0x36DA, 0xE371, 0xBC91, 0xDBD4, 0xF206, 0x567F,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xC150, 0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0xC097, 0x6E4A, 0xA22C,
+        0x5F17, 0x1FD2, 0x5F14, 0x2180, 0xFE55, 0x434D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xF17D, 0x1FF2,
+        0xC1FA, 0xFF40, 0xA3E7, 0x946, 0x91BC, 0x14BD, 0x7E22, 0x9419, 0x7763,
+        0xFE75, 0xA942, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xA35F, 0x1918, 0xAC54, 0xD5ED, 0xFD21, 0xB430, 0x922C, 0x227C, 0x2613,
+        0x6DA9, 0x51E5, 0x4BB0, 0xA33F, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0xFCC3, 0xD27A, 0xA57F, 0xABB,
+        0x1B6A, 0xF4AF, 0xAC16, 0x60DE, 0xBF38, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xED9E, 0xD23E, 0x403F, 0x70E, 0x83A5, 0x95A2, 0x7402, 0x7531, 0x80E4,
+        0xA6F1, 0xD5B8, 0x639C, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0xD300, 0x6E4A, 0xBAE3, 0x8C26, 0xB64E,
+        0x62CB, 0xF8AB, 0xA480, 0xBB35, 0xA0D9, 0xB653, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x9F71, 0x1FF2, 0x1FF2, 0x7A59, 0xC2A9, 0x91FE, 0xA5FA, 0xD12C, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x5D50, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x305C, 0x8EF6, 0x1D76,
+        0xCE13, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xAF41, 0xDB3E, 0x135C,
+        0x468A, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xA8FD, 0x20A8, 0x2816,
+        0xB618, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xB9BD, 0x46CC, 0xC25D,
+        0x8ECC, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xD955, 0x508, 0x72E1,
+        0x1E71, 0x3C02, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xF479, 0x34FD,
+        0xCD87, 0xA50D, 0x97A9, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0xF3B,
+        0xB9BD, 0x46CC, 0xC25D, 0xB618, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x6B39, 0x8F67, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x9C3A, 0x3DDC,
+        0x305C, 0x8EF6, 0x1D76, 0x5D50, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0xF479, 0x34FD, 0x1E71, 0x3C02, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0xA8FD, 0x20A8, 0x2816, 0x468A, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239,
+        0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6,
+        0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135,
+        0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468,
+        0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239,
+        0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xD892, 0xD892, 0xD892, 0xD892, 0xD892, 0xD892, 0xD892, 0xD892, 0xD892,
+        0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135,
+        0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468,
+        0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x737F, 0x737F, 0x737F, 0x737F, 0x737F, 0x737F, 0x737F, 0x737F, 0x737F,
+        0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xD892, 0xD892, 0xD892, 0xD892, 0xD892, 0xD892, 0xD892, 0xD892, 0xD892,
+        0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135,
+        0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468,
+        0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x737F, 0x737F, 0x737F, 0x737F, 0x737F, 0x737F, 0x737F, 0x737F, 0x737F,
+        0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xBF8, 0xBF8, 0xBF8, 0xBF8, 0xBF8, 0xBF8, 0xBF8, 0xBF8, 0xBF8,
+        0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135,
+        0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468,
+        0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738, 0x9738,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239,
+        0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6,
+        0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135,
+        0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468,
+        0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xA529, 0xA529, 0xA529, 0xA529, 0xA529, 0xA529, 0xA529, 0xA529, 0xA529,
+        0x7153, 0x7153, 0x7153, 0x7153, 0x7153, 0x7153, 0x7153, 0x7153, 0x7153,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54,
+        0x5A4F, 0x5A4F, 0x5A4F, 0x5A4F, 0x5A4F, 0x5A4F, 0x5A4F, 0x5A4F, 0x5A4F,
+        0x9128, 0x9128, 0x9128, 0x9128, 0x9128, 0x9128, 0x9128, 0x9128, 0x9128,
+        0xB12D, 0xB12D, 0xB12D, 0xB12D, 0xB12D, 0xB12D, 0xB12D, 0xB12D, 0xB12D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4,
+        0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x5834, 0x5834, 0x5834, 0x5834, 0x5834, 0x5834, 0x5834, 0x5834, 0x5834,
+        0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E,
+        0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B,
+        0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xA5D4, 0xA5D4, 0xA5D4, 0xA5D4, 0xA5D4, 0xA5D4, 0xA5D4, 0xA5D4, 0xA5D4,
+        0xAA58, 0xAA58, 0xAA58, 0xAA58, 0xAA58, 0xAA58, 0xAA58, 0xAA58, 0xAA58,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xB44B, 0xB44B, 0xB44B, 0xB44B, 0xB44B, 0xB44B, 0xB44B, 0xB44B, 0xB44B,
+        0xE791, 0xE791, 0xE791, 0xE791, 0xE791, 0xE791, 0xE791, 0xE791, 0xE791,
+        0xBA1E, 0xBA1E, 0xBA1E, 0xBA1E, 0xBA1E, 0xBA1E, 0xBA1E, 0xBA1E, 0xBA1E,
+        0x659F, 0x659F, 0x659F, 0x659F, 0x659F, 0x659F, 0x659F, 0x659F, 0x659F,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239, 0xF239,
+        0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120, 0xB120,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6, 0x3BB6,
+        0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135, 0xD135,
+        0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468, 0x468,
+        0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A, 0x8F0A,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4, 0x53F4,
+        0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A, 0x624A,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x5834, 0x5834, 0x5834, 0x5834, 0x5834, 0x5834, 0x5834, 0x5834, 0x5834,
+        0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E, 0xB97E,
+        0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B, 0x6A2B,
+        0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D, 0xEB8D,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x8BE1, 0x8BE1, 0x8BE1, 0x8BE1, 0x8BE1, 0x8BE1, 0x8BE1, 0x8BE1, 0x8BE1,
+        0x2181, 0x2181, 0x2181, 0x2181, 0x2181, 0x2181, 0x2181, 0x2181, 0x2181,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0x3531, 0x3531, 0x3531, 0x3531, 0x3531, 0x3531, 0x3531, 0x3531, 0x3531,
+        0xA22C, 0xA22C, 0xA22C, 0xA22C, 0xA22C, 0xA22C, 0xA22C, 0xA22C, 0xA22C,
+        0x5204, 0x5204, 0x5204, 0x5204, 0x5204, 0x5204, 0x5204, 0x5204, 0x5204,
+        0xC428, 0xC428, 0xC428, 0xC428, 0xC428, 0xC428, 0xC428, 0xC428, 0xC428,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+        0xC2A5, 0xC2A5, 0xC2A5, 0xC2A5, 0xC2A5, 0xC2A5, 0xC2A5, 0xC2A5, 0xC2A5,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xA20A, 0xA20A, 0xA20A, 0xA20A, 0xA20A, 0xA20A, 0xA20A, 0xA20A, 0xA20A,
+        0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2, 0x1FF2,
+        0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D, 0x411D,
+        0xA140, 0xA140, 0xA140, 0xA140, 0xA140, 0xA140, 0xA140, 0xA140, 0xA140,
+        0x87AC, 0x535, 0xB6F6, 0x2FA0, 0x100E, 0x7FBD, 0x6311, 0x7F0C, 0x5D69,
+        0xE5DA, 0x5290, 0xE0E0, 0x148D, 0x7E94, 0x5290, 0xE0E0, 0x6311, 0x7F0C,
+        0x1A9E, 0x1C5E, 0xBF92, 0x976, 0xAE0E, 0x9720, 0xC95C, 0x748B, 0xF3EB,
+        0xE0E7, 0x8C04, 0x28FA, 0x2E65, 0xBBE0, 0x21C6, 0x952E, 0x30B9, 0x52D,
+        0x75D7, 0x7613, 0x6311, 0x7F0C, 0x93EB, 0x93EB, 0x5D69, 0x28FA, 0xAE0E,
+        0xF26B, 0xCBF3, 0x1C5E, 0xCC9, 0x5A4E, 0xE6EA, 0x5065, 0x11B3, 0x3A9D,
+        0x100E, 0x7FBD, 0x6311, 0x7F0C, 0x93EB, 0xF3EB, 0xCAE9, 0x8232, 0xC212,
+        0xB5B1, 0xC212, 0xB5B1, 0x7868, 0xB315, 0xF3EB, 0xF81E, 0x5AAB, 0xEDBA,
+        0x1419, 0x9104, 0x4DB3, 0x6EEA, 0x100E, 0x3A9D, 0x5AAA, 0xC858, 0x369B,
+        0xCC88, 0x7800, 0x7BF9, 0x21C7, 0xF87A, 0x6998, 0xB71E, 0x5AAA, 0xC858,
+        0x857E, 0xC0DC, 0x21C1, 0x72BD, 0xEEE1, 0x1CFC, 0x451F, 0x748B, 0xF3EB,
+        0xFB57, 0x7952, 0xE17E, 0x6B45, 0x825C, 0xCAFF, 0xFCDB, 0x5AE0, 0x1E9D,
+        0xCFF4, 0xAC12, 0xDAE4, 0xC858, 0x80F2, 0x80F2, 0x7952, 0xFD3A, 0x1F93,
+        0x31FF, 0x8C0, 0xC0DC, 0xBBDB, 0xA2FA, 0x41D1, 0x3100, 0xF40, 0x7FAC,
+        0x5150, 0x7FBD, 0x5AAA, 0xF59E, 0x1CAC, 0xF3EB, 0x2CA6, 0xF566, 0xC212,
+        0xB5B1, 0xC212, 0xB5B1, 0x11D9, 0x1A1E, 0xF3EB, 0x5D56, 0xA3D7, 0xA5A3,
+        0x80CE, 0xE547, 0x7313, 0x15D4, 0x66B4, 0xAED8, 0x5AAA, 0xE40E, 0x4A9C,
+        0xAB2C, 0x4D57, 0x608F, 0x2F8B, 0xCF08, 0xD056, 0x3D4A, 0x613A, 0x420F,
+        0xB11B, 0x5F98, 0x940, 0x746D, 0x1AFD, 0x468C, 0xC68C, 0x748B, 0x2822,
+        0x4241, 0xFA9B, 0xA927, 0xCFFA, 0xC301, 0x72ED, 0xEFA1, 0xF1DC, 0x7F24,
+        0x56AA, 0x8632, 0xDAE4, 0xE40E, 0x80F2, 0x80F2, 0xEB31, 0xDED, 0xBEB4,
+        0xDA43, 0x7F76, 0x56FE, 0x5FF5, 0x174A, 0x950F, 0x72C8, 0x899E, 0xD991,
+        0x2C9F, 0x3A9D, 0xDAE4, 0xD2B0, 0x270C, 0xF3EB, 0x3281, 0x3CE2, 0xC1A2,
+        0xB5B1, 0xC1A2, 0xB570, 0x11D9, 0x6B3F, 0xF3EB, 0x761, 0xA520, 0x2B9D,
+        0xA00A, 0x161B, 0x4E00, 0xBC5E, 0x5103, 0xB621, 0x8958, 0x64A6, 0xB2F7,
+        0x22F6, 0xC8F5, 0x8F1A, 0x186F, 0xFDB, 0x43FF, 0x15F0, 0xB035, 0x6F6D,
+        0x3323, 0x154A, 0x8FB7, 0x4BCE, 0x6849, 0xEFF6, 0xBAE1, 0x23EF, 0xA12A,
+        0x2079, 0xFEAF, 0xDED, 0xB109, 0x5A88, 0x710E, 0x7C63, 0x95D7, 0x730D,
+        0x21C6, 0xE159, 0x5C70, 0xEF7C, 0x3607, 0x3607, 0x2FC2, 0xB1C7, 0x1AFD,
+        0x5109, 0x80F, 0xE910, 0x816B, 0x65A0, 0x15C0, 0x570C, 0x5085, 0xC2F0,
+        0xC6A8, 0xB621, 0xDAE4, 0xD572, 0x1FB6, 0xF3BC, 0xAA6F, 0x3CE2, 0x90AE,
+        0x2C02, 0x90AE, 0xDF12, 0x6A90, 0x7598, 0x1FA8, 0x5AE, 0x66E6, 0x1A54,
+        0xD044, 0xC543, 0x627E, 0x6FB6, 0x6EA9, 0x89DB, 0x9F27, 0x7E6, 0x1F1D,
+        0x9905, 0x5C70, 0x49CB, 0x57DB, 0xC026, 0xAE04, 0x217C, 0x7F4C, 0x56A2,
+        0x3929, 0x8950, 0x547F, 0x2B96, 0x8FD0, 0x13A0, 0xE2BE, 0x50FA, 0x3595,
+        0xA079, 0xBB2A, 0x414F, 0x1C88, 0x398B, 0x6302, 0xF3BE, 0xE5F6, 0x3237,
+        0xC1E8, 0x24FF, 0x1F23, 0xCE00, 0x4B50, 0xB43D, 0x424F, 0x12DD, 0xD75D,
+        0x4220, 0x6A28, 0xC77, 0xD011, 0x5C7F, 0xA3B1, 0x55FD, 0x9C26, 0x753F,
+        0xFA32, 0x8810, 0xE832, 0xB45A, 0x741E, 0x3A7C, 0x7738, 0xF769, 0xC3D7,
+        0x2BF3, 0xA714, 0xC88, 0xF92D, 0x7CD7, 0x956B, 0xC1AF, 0xFB05, 0x9816,
+        0xA0A9, 0x5A1A, 0x9CB1, 0x270B, 0xC1D6, 0x5F2E, 0xA9B, 0xA61E, 0xEC7,
+        0x3212, 0x189A, 0x6844, 0x5819, 0x8C58, 0x4868, 0x261B, 0xF132, 0x637F,
+        0x97FE, 0x4C74, 0x1BF2, 0xC86E, 0xC386, 0x4D31, 0x8954, 0x78D6, 0xE182,
+        0x79FB, 0x43B6, 0x2CB7, 0x3FB7, 0xB77E, 0x8A5A, 0xE10C, 0xFC28, 0xD858,
+        0xBB74, 0xE957, 0x56DE, 0xD621, 0xF0A8, 0x9365, 0xF426, 0xEE90, 0x4F3,
+        0x68BB, 0x8AF1, 0x43CF, 0x5F41, 0x4549, 0x359E, 0xAF32, 0x9E01, 0xEAC2,
+        0x2CB7, 0x1F26, 0x42CC, 0x7AED, 0xD895, 0x4FD2, 0xF4F, 0x59AB, 0x9B4B,
+        0x8141, 0xDB7B, 0x2BE7, 0x3497, 0xF34A, 0x8BAF, 0xEDBC, 0xAC3C, 0x1C53,
+        0x2371, 0x841C, 0x93E0, 0x1C5D, 0xA56E, 0xD7B1, 0x7E61, 0x2845, 0xF121,
+        0x5D4F, 0xA9DA, 0x90C8, 0xD09E, 0x3CD1, 0xF091, 0xBEFC, 0x1F77, 0xA93,
+        0x359B, 0x1462, 0x6699, 0xEBBB, 0xB9F7, 0x7E81, 0xFCB6, 0xD3E, 0xFD59,
+        0x8154, 0x43DE, 0x390D, 0x64E, 0xD1E1, 0x2BA6, 0x5C69, 0x5AFF, 0x8C03,
+        0x3EF5, 0x3954, 0xADF2, 0x95A9, 0xD4D, 0x99F3, 0xB301, 0x9AC9, 0x3B8F,
+        0x9321, 0x846, 0x63E3, 0x8EDA, 0xECC5, 0xF1D8, 0x292D, 0xC51A, 0x20A1,
+        0x310C, 0x181F, 0xFEE5, 0x2CE5, 0xDA00, 0x1E26, 0x8C48, 0x37A, 0xF0C,
+        0x1483, 0x43B7, 0x5B45, 0xFC33, 0xB10D, 0x6BF4, 0x10C1, 0x343, 0x6604,
+        0x5D7, 0x9240, 0x1176, 0x2B4E, 0x5D39, 0x57DE, 0xFF40, 0xA035, 0x89C7,
+        0x9B8A, 0x77E, 0x4D71, 0xEA89, 0xA267, 0xC08F, 0x25AB, 0x5497, 0x1466,
+        0x873C, 0xE386, 0x6D99, 0x844E, 0xD679, 0x6C00, 0x7D45, 0x67C1, 0xA2C1,
+        0x4F49, 0xA600, 0x717A, 0x9149, 0x6876, 0xAC37, 0x3B63, 0x5DC3, 0x3D09,
+        0x3B89, 0xB6BE, 0x7744, 0x2350, 0x2F90, 0xC972, 0x6A56, 0xA472, 0x5655,
+        0x8489, 0x36, 0x19A2, 0x53E0, 0x3643, 0xEF96, 0x5FFC, 0xAC36, 0x7316,
+        0xFCEA, 0x70E7, 0xF042, 0x11CB, 0xA118, 0xA08C, 0x469F, 0x4148, 0x3A9B,
+        0x6ED8, 0xFFA, 0x2A05, 0x1930, 0x1457, 0x8773, 0x76A5, 0x6E4F, 0xA341,
+        0x3CB6, 0x7503, 0x2F66, 0xD7AD, 0x39D3, 0x9A13, 0x78B2, 0xD5C8, 0x9041,
+        0x96F2, 0xBA14, 0xDE27, 0x5819, 0x32D9, 0x2040, 0xD086, 0x89E3, 0xA03B,
+        0x4B69, 0x63A2, 0xE8DD, 0x3BF0, 0xC0D0, 0x71C6, 0x633D, 0x354, 0x2B18,
+        0x20B9, 0xB270, 0xFEC8, 0x749C, 0xC811, 0xFD9, 0x4325, 0x3F14, 0xD3F0,
+        0x5E25, 0x3F7D, 0xEC0E, 0xCEDD, 0x96E7, 0x7C6D, 0x8733, 0xABA4, 0xB09E,
+        0x13AB, 0x9648, 0xF173, 0x83FF, 0x9C14, 0xA93, 0x2FF3, 0xDB21, 0xEB5D,
+        0xB386, 0x1F26, 0x6D6, 0xD5FB, 0x3D3B, 0x509B, 0xB47, 0x3BB8, 0x6DB6,
+        0x7D9A, 0x5F00, 0x94EB, 0xF7B2, 0x7D43, 0xEDAB, 0xB7C3, 0x924A, 0x2D3,
+        0x5512, 0x4CC7, 0x12A1, 0xBC37, 0x8BDB, 0xF2ED, 0x217C, 0xB4CA, 0xD89C,
+        0xD4EC, 0xF490, 0xCC80, 0x6C36, 0x786E, 0xE3, 0x9F26, 0x98DB, 0x8251,
+        0x2365, 0xBBFB, 0xDDF6, 0xE933, 0xDB87, 0xD46E, 0x8611, 0x8480, 0x702F,
+        0x8732, 0x6A04, 0x6188, 0xB52C, 0x8631, 0x83C0, 0x2A97, 0xE5C1, 0x5958,
+        0xAE95, 0x3A12, 0x6261, 0x21EA, 0x74D6, 0xC753, 0x3978, 0xF231, 0x2864,
+        0xC627, 0x934F, 0x75AF, 0x7C89, 0x8361, 0x94EF, 0x67A7, 0x11E5, 0x9C91,
+        0x1585, 0x4A93, 0x1707, 0x2610, 0xD371, 0x624E, 0x31F3, 0x19D8, 0xE601,
+        0x441F, 0x2110, 0xABF0, 0xE2D, 0x4BA3, 0x4A5, 0x19A5, 0x160, 0x571B,
+        0xF573, 0xBDFA, 0x262B, 0x2CDD, 0x1556, 0xE268, 0xD53, 0xF708, 0x7C42,
+        0x2F82, 0x5383, 0x77F0, 0x18D1, 0x6AB2, 0x7614, 0x77D6, 0x1F15, 0x2E05,
+        0x6096, 0xF10C, 0x8180, 0x353F, 0x5DC9, 0x6321, 0xC658, 0x4CF6, 0x60C2,
+        0x3752, 0xCC68, 0x31DD, 0x3548, 0xD2F, 0xE2F8, 0x96D5, 0xF9F4, 0xCCC6,
+        0x33A9, 0x9273, 0xEF98, 0xBC79, 0xE7DB, 0x473C, 0x8A95, 0xFCFE, 0x582F,
+        0x3FED, 0xADD8, 0xDD17, 0x75CD, 0x8149, 0x4D7D, 0xA483, 0xA24F, 0xA2F7,
+        0xE37B, 0x87A4, 0x6FEE, 0x2383, 0xC30E, 0x3458, 0x5ED2, 0x4EEB, 0x14FB,
+        0xC4EE, 0x7282, 0x2C60, 0x7165, 0xF695, 0x2795, 0x6574, 0xFF81, 0x44A1,
+        0x5116, 0x612B, 0x25AC, 0xADE1, 0xBFBA, 0x5EA, 0xB368, 0x32B8, 0x46F9,
+        0x1DB, 0x25A4, 0x63C6, 0x6981, 0x4407, 0x1316, 0x7E55, 0x4B4A, 0x6F67,
+        0x7F4B, 0xC882, 0x3E15, 0xEF68, 0x6117, 0x3CC3, 0xF1C1, 0xADDD, 0x57D3,
+        0x61BE, 0xC159, 0x82F4, 0xBFC3, 0x3767, 0xA2FA, 0xBA25, 0x8BA7, 0x8A83,
+        0x4467, 0x42C6, 0x8966, 0x98FE, 0xEE6C, 0x6477, 0x11E1, 0x8735, 0x1EB6,
+        0xE456, 0x4F7A, 0xD877, 0xD047, 0xE1D, 0x43C9, 0x15F2, 0xC717, 0xCFD5,
+        0xA944, 0x8184, 0xB502, 0xE87B, 0xDECA, 0x2949, 0xE386, 0xCF6E, 0xE6A2,
+        0x1438, 0xA48C, 0x3F26, 0x8BC6, 0x57A3, 0x786A, 0xF575, 0x882F, 0xE45D,
+        0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD,
+        0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D,
+        0xBB36, 0xBB36, 0xBB36, 0xBB36, 0xBB36, 0xBB36, 0xBB36, 0xBB36, 0xBB36,
+        0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8,
+        0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31,
+        0x1BC5, 0x1BC5, 0x1BC5, 0x1BC5, 0x1BC5, 0x1BC5, 0x1BC5, 0x1BC5, 0x1BC5,
+        0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0,
+        0xEAFA, 0xEAFA, 0xEAFA, 0xEAFA, 0xEAFA, 0xEAFA, 0xEAFA, 0xEAFA, 0xEAFA,
+        0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F,
+        0x82E9, 0x82E9, 0x82E9, 0x82E9, 0x82E9, 0x82E9, 0x82E9, 0x82E9, 0x82E9,
+        0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C,
+        0x4261, 0x4261, 0x4261, 0x4261, 0x4261, 0x4261, 0x4261, 0x4261, 0x4261,
+        0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215,
+        0x6C3A, 0x6C3A, 0x6C3A, 0x6C3A, 0x6C3A, 0x6C3A, 0x6C3A, 0x6C3A, 0x6C3A,
+        0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5,
+        0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4,
+        0xEEC0, 0xEEC0, 0xEEC0, 0xEEC0, 0xEEC0, 0xEEC0, 0xEEC0, 0xEEC0, 0xEEC0,
+        0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92,
+        0x429A, 0x429A, 0x429A, 0x429A, 0x429A, 0x429A, 0x429A, 0x429A, 0x429A,
+        0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0,
+        0x39CC, 0x39CC, 0x39CC, 0x39CC, 0x39CC, 0x39CC, 0x39CC, 0x39CC, 0x39CC,
+        0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD,
+        0x4969, 0x4969, 0x4969, 0x4969, 0x4969, 0x4969, 0x4969, 0x4969, 0x4969,
+        0x7995, 0x7995, 0x7995, 0x7995, 0x7995, 0x7995, 0x7995, 0x7995, 0x7995,
+        0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62,
+        0x860F, 0x860F, 0x860F, 0x860F, 0x860F, 0x860F, 0x860F, 0x860F, 0x860F,
+        0x4E19, 0x4E19, 0x4E19, 0x4E19, 0x4E19, 0x4E19, 0x4E19, 0x4E19, 0x4E19,
+        0x4969, 0x4969, 0x4969, 0x4969, 0x4969, 0x4969, 0x4969, 0x4969, 0x4969,
+        0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7,
+        0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4,
+        0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0,
+        0x477E, 0x477E, 0x477E, 0x477E, 0x477E, 0x477E, 0x477E, 0x477E, 0x477E,
+        0xB626, 0xB626, 0xB626, 0xB626, 0xB626, 0xB626, 0xB626, 0xB626, 0xB626,
+        0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C,
+        0xE1C9, 0xE1C9, 0xE1C9, 0xE1C9, 0xE1C9, 0xE1C9, 0xE1C9, 0xE1C9, 0xE1C9,
+        0xD313, 0xD313, 0xD313, 0xD313, 0xD313, 0xD313, 0xD313, 0xD313, 0xD313,
+        0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215,
+        0x7995, 0x7995, 0x7995, 0x7995, 0x7995, 0x7995, 0x7995, 0x7995, 0x7995,
+        0x7241, 0x7241, 0x7241, 0x7241, 0x7241, 0x7241, 0x7241, 0x7241, 0x7241,
+        0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D,
+        0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62,
+        0xB353, 0xB353, 0xB353, 0xB353, 0xB353, 0xB353, 0xB353, 0xB353, 0xB353,
+        0x612E, 0x612E, 0x612E, 0x612E, 0x612E, 0x612E, 0x612E, 0x612E, 0x612E,
+        0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0,
+        0xB92B, 0xB92B, 0xB92B, 0xB92B, 0xB92B, 0xB92B, 0xB92B, 0xB92B, 0xB92B,
+        0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD, 0x42BD,
+        0xF051, 0xF051, 0xF051, 0xF051, 0xF051, 0xF051, 0xF051, 0xF051, 0xF051,
+        0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD, 0xC5CD,
+        0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0,
+        0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA,
+        0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C, 0x195C,
+        0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4,
+        0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1,
+        0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3,
+        0x4CAA, 0x4CAA, 0x4CAA, 0x4CAA, 0x4CAA, 0x4CAA, 0x4CAA, 0x4CAA, 0x4CAA,
+        0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1,
+        0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3, 0xD7C3,
+        0xB831, 0xB831, 0xB831, 0xB831, 0xB831, 0xB831, 0xB831, 0xB831, 0xB831,
+        0x176C, 0x176C, 0x176C, 0x176C, 0x176C, 0x176C, 0x176C, 0x176C, 0x176C,
+        0x2567, 0x2567, 0x2567, 0x2567, 0x2567, 0x2567, 0x2567, 0x2567, 0x2567,
+        0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6,
+        0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8, 0xC9B8,
+        0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D, 0xA54D,
+        0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4, 0xE1C4,
+        0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62,
+        0x6D5B, 0x6D5B, 0x6D5B, 0x6D5B, 0x6D5B, 0x6D5B, 0x6D5B, 0x6D5B, 0x6D5B,
+        0xD601, 0xD601, 0xD601, 0xD601, 0xD601, 0xD601, 0xD601, 0xD601, 0xD601,
+        0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6,
+        0x2C89, 0x2C89, 0x2C89, 0x2C89, 0x2C89, 0x2C89, 0x2C89, 0x2C89, 0x2C89,
+        0xE68F, 0xE68F, 0xE68F, 0xE68F, 0xE68F, 0xE68F, 0xE68F, 0xE68F, 0xE68F,
+        0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5,
+        0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6, 0xDBB6,
+        0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1,
+        0xBFA6, 0xBFA6, 0xBFA6, 0xBFA6, 0xBFA6, 0xBFA6, 0xBFA6, 0xBFA6, 0xBFA6,
+        0xE7E3, 0xE7E3, 0xE7E3, 0xE7E3, 0xE7E3, 0xE7E3, 0xE7E3, 0xE7E3, 0xE7E3,
+        0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92, 0x9C92,
+        0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5, 0xD7F5,
+        0x1262, 0x1262, 0x1262, 0x1262, 0x1262, 0x1262, 0x1262, 0x1262, 0x1262,
+        0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA, 0x25AA,
+        0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31, 0x8D31,
+        0xF0BB, 0xF0BB, 0xF0BB, 0xF0BB, 0xF0BB, 0xF0BB, 0xF0BB, 0xF0BB, 0xF0BB,
+        0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04,
+        0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6, 0xB9E6,
+        0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7, 0x89D7,
+        0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1, 0xEDB1,
+        0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62, 0x7B62,
+        0xD313, 0xD313, 0xD313, 0xD313, 0xD313, 0xD313, 0xD313, 0xD313, 0xD313,
+        0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04, 0x2A04,
+        0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0,
+        0x70B6, 0x70B6, 0x70B6, 0x70B6, 0x70B6, 0x70B6, 0x70B6, 0x70B6, 0x70B6,
+        0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F, 0xD43F,
+        0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0, 0x6CD0,
+        0xE514, 0xE514, 0xE514, 0xE514, 0xE514, 0xE514, 0xE514, 0xE514, 0xE514,
+        0xD82D, 0xD82D, 0xD82D, 0xD82D, 0xD82D, 0xD82D, 0xD82D, 0xD82D, 0xD82D,
+        0x2567, 0x2567, 0x2567, 0x2567, 0x2567, 0x2567, 0x2567, 0x2567, 0x2567,
+        0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215, 0xB215,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x5DFC, 0xC4E3, 0x788C, 0x4308,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x1D3B, 0xF9E3, 0x73E9, 0x4308,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xE8A6, 0x451, 0x73E9, 0x4308,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0x2955, 0x1AF5, 0x61BC, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0x6625, 0xFC54, 0xA203, 0xC1ED, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x1D3B, 0x2A07, 0xE817, 0x9873,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xC469, 0x3627, 0xFC69, 0x737B,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xF1B7, 0x8A07, 0x66C1, 0xD0D9,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xF2FD, 0x1AF5, 0x7F40, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xDE4C, 0xC5FD, 0x1727, 0xCF94, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x4E4C, 0x8E9F, 0xC834, 0x7FF6,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAB08, 0x58F1, 0xE817, 0x7FF6,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x68D6, 0x58F1, 0x9E7C, 0x7FF6,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xF2FD, 0x1AF5, 0xFB49, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0x44FE, 0xAD52, 0x2A4D, 0xFC67, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x9A40, 0x59D4, 0x4A58, 0xD338,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x27D7, 0xB7, 0x11C, 0xF9B0,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x27D7, 0x3B57, 0x7709, 0xF9B0,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0x684F, 0xB717, 0x1511, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xD210, 0xD2A6, 0x1030, 0x18FA, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xFC30, 0x8EBF, 0x5434, 0xD338,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xEBE8, 0x20A4, 0xB569, 0xD338,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xEBE8, 0x9EEA, 0xD458, 0xD338,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0x684F, 0xB717, 0x4DCA, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xD210, 0xB532, 0x6BEC, 0xB07B, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xD67C, 0x7257, 0xE0AD, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x7F6D, 0xA840, 0x78D6, 0xC7E2, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xB464, 0xB98C, 0x84AE, 0xE811, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0x9B8, 0x91CA, 0xC8A3, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xD508, 0x5557, 0x6546, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xD210, 0x596B, 0x3B2A, 0xA27B, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x8D43, 0xA698, 0x4959, 0xB0C8, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xDD3B, 0xB8A2, 0x8C89, 0xE142, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0x4846, 0x3789, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xE0FC, 0x56EE, 0xA380, 0xD338, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xDE4C, 0xBD13, 0xD201, 0xE79B, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x242D, 0xD40D, 0x527D, 0x270C, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x78BC, 0x7925, 0x6FB9, 0xE3A6, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0x2CD1, 0x8AAA, 0x2B3C, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xFE36, 0x35C5, 0x9D54, 0x7FF6, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xF54F, 0x4BF6, 0x393F, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x44FE, 0x7B1D, 0x3FA6, 0xA255, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x44FE, 0x2B6A, 0x5F3A, 0x150A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0x9B8, 0xFEF7, 0xDAE5, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0x72BA, 0x967F, 0xBB41, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x44FE, 0x8FF1, 0x1845, 0xDDD2, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x5009, 0x428C, 0xE7EE, 0x387E, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xF84C, 0x7DED, 0x2163, 0x7C95, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xCB12, 0x2210, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xD43B, 0x79F0, 0x1052, 0x968D, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAEC4, 0xB7E9, 0x846C, 0x7971, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xC2B1, 0xB593, 0xDAAD, 0xA0D8, 0xF407, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xD210, 0x1204, 0xDD48, 0x50C0, 0x9533, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0x11FB, 0x5814, 0x7108, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xB464, 0x1AA6, 0xA2F0, 0xC6F1, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0x66EC, 0x4243, 0xDE46, 0xD338, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0x8490, 0xB11C, 0x4E5E, 0x43AA, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0x2B16, 0xD929, 0xC9E4, 0x8480, 0x7FF6, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xF98B, 0x2AAE, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xBAF1, 0xBE37, 0xC12, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xAD7A, 0xAD7A, 0xF34F, 0xDF58, 0x649C, 0xAD7A, 0xAD7A, 0xAD7A, 0xAD7A,
+        0xECFF, 0x9CB1, 0x199F, 0xF976, 0x9E19, 0xBE2D, 0xAE3D, 0xCCE5, 0xB5BA,
+        0x9026, 0xDF68, 0x51D9, 0x7F0, 0x27B6, 0x1B75, 0x9AE8, 0xC3BE, 0x11E8,
+        0x402, 0xFD2E, 0x14B2, 0xDDFC, 0x1D4, 0x2932, 0xA946, 0x6418, 0x48FA,
+        0x926C, 0xDA7E, 0x4A4, 0x3105, 0x98B2, 0x8D86, 0x84DD, 0xA416, 0x7FB9,
+        0x9E7C, 0xA4CD, 0x63EE, 0x5BCF, 0x7CAC, 0xCC28, 0x78D3, 0x5744, 0xDD1,
+        0x190C, 0x1141, 0xA5F8, 0x3DAA, 0x55A2, 0x9769, 0xD367, 0x6897, 0x35A9,
+        0x10FF, 0xC788, 0x2088, 0x30F1, 0xEC0E, 0x2CC7, 0xDD8A, 0x1853, 0xF7F7,
+        0x2C58, 0x46B6, 0x95BF, 0x1CCC, 0x35D4, 0x705E, 0xA4A3, 0xE7FE, 0x3293,
+        0x29AF, 0x9491, 0xB47F, 0xD8B4, 0xEF4, 0x3D5D, 0x20C9, 0xB159, 0xEE87,
+        0xAC6C, 0x1F63, 0x65AD, 0x4517, 0xE0F2, 0xF503, 0x6FDE, 0xB802, 0x2E8D,
+        0x1E52, 0x42A4, 0x15D4, 0x958A, 0xA3FD, 0x355F, 0x8A1B, 0x1D39, 0x68C5,
+        0x6FA5, 0x30C3, 0xCC64, 0xE8F3, 0x5CD5, 0xEF49, 0xFACF, 0xA888, 0xCC90,
+        0xDCE2, 0xAC09, 0x847B, 0x77F1, 0x1390, 0x1855, 0xF0E2, 0x8A1E, 0xBF38,
+        0x979F, 0x294B, 0xF6C8, 0xEFF6, 0xA1FD, 0x1D0, 0x9A9F, 0x969, 0x9646,
+        0x4E91, 0x1CD1, 0x9FEE, 0x12C9, 0x4702, 0x306F, 0x4D66, 0x4689, 0xB76,
+        0xB27B, 0x27D8, 0xBD59, 0x1A30, 0xFACD, 0xD6C1, 0xEB7E, 0xE149, 0x5CFF,
+        0xE51E, 0xECBA, 0x7CBF, 0x1532, 0x92B4, 0xBBC8, 0x189D, 0x2E16, 0xA992,
+        0x639F, 0x8C0A, 0xADD0, 0x2A14, 0x5C10, 0x4A54, 0xF978, 0x8046, 0xB93B,
+        0x849E, 0xD283, 0xBF26, 0xF9A4, 0xE76A, 0x953B, 0xD111, 0x4FF3, 0xFBF8,
+        0x5573, 0x85AA, 0xD42, 0x246B, 0xF7D9, 0xBBF8, 0x23DE, 0xF652, 0x5B43,
+        0xCE91, 0x3F03, 0xB923, 0xDCD5, 0xA2E3, 0xBC7, 0xE1ED, 0x6E66, 0xED75,
+        0x655, 0x3F46, 0xC2AF, 0x958B, 0xC16A, 0x2210, 0x2521, 0xD671, 0xCB4D,
+        0x821D, 0x74B5, 0xCA95, 0xF655, 0xF714, 0xFB6B, 0x7C61, 0x6F6E, 0x3D6,
+        0xA826, 0x2E41, 0xA687, 0x589D, 0x47DB, 0xD88, 0x8433, 0x32CC, 0x8142,
+        0xB22A, 0x5387, 0xBD99, 0x6F7F, 0xB01A, 0xB23, 0xC7AB, 0xC9B2, 0x7D07,
+        0xB04D, 0xAF5B, 0x3F17, 0x6394, 0xC358, 0xB8, 0x8DF0, 0x9FB6, 0x895B,
+        0x8542, 0x9339, 0x299A, 0x648C, 0xB10, 0x8622, 0x9CE5, 0x63B, 0xEB73,
+        0xBD2, 0xC8F2, 0x239E, 0x590C, 0x47CF, 0x595D, 0xA26B, 0xDFB5, 0x3221,
+        0xBA93, 0xB275, 0xD423, 0x514D, 0x9191, 0x985F, 0x5D6F, 0x1B67, 0x2549,
+        0xD80D, 0x859F, 0xFC18, 0xF3AA, 0x8AFF, 0x89E5, 0x176A, 0x4317, 0x4159,
+        0xB72C, 0x34F0, 0x4BA3, 0x1B7D, 0x4031, 0x5F8A, 0xF879, 0xC6A6, 0x8142,
+        0x3377, 0xC95D, 0xCB58, 0xC7E9, 0x5908, 0x285E, 0x7245, 0x68D5, 0xCF5F,
+        0xE2D9, 0xD64D, 0x6BAF, 0x4746, 0xB566, 0x55F1, 0x7E3A, 0xA71C, 0xA4DC,
+        0xE9F5, 0xCB89, 0xB36, 0x6429, 0xD740, 0x67C7, 0x6AE4, 0x885D, 0x5813,
+        0x23DB, 0x2003, 0x6142, 0x2487, 0xB9E0, 0xD904, 0x74A2, 0x1EE6, 0x9B4F,
+        0xEB91, 0x25F3, 0x272E, 0xF606, 0x2270, 0xCBD0, 0xA5BD, 0x467A, 0x4588,
+        0x8844, 0xD22F, 0x2967, 0x9CEF, 0x3DCA, 0x5098, 0x8EBC, 0xF42E, 0x87C0,
+        0x30BD, 0x9C25, 0x1D32, 0x795, 0xB859, 0x7BCA, 0x8A4A, 0x990, 0xEA25,
+        0x3384, 0xDB95, 0x23E0, 0x522C, 0x143E, 0x736C, 0x1CEA, 0x20, 0xE654,
+        0xECE5, 0xA0EB, 0x7D1E, 0xCC66, 0x80A9, 0x855, 0x8AB9, 0xC215, 0x4F8,
+        0x6E47, 0x96F3, 0x8ECA, 0x9FEE, 0x90A7, 0xA75C, 0xBC48, 0x59B6, 0x393B,
+        0x328B, 0xB27B, 0x15A1, 0x6316, 0x1A30, 0xAC02, 0xB646, 0xF24, 0x899,
+        0x957D, 0x8D49, 0x8288, 0xEE1E, 0x6022, 0x1BE5, 0x6B7E, 0x1271, 0xB57C,
+        0xF486, 0x876, 0x5988, 0x50B, 0x58E3, 0x56D2, 0xCDEE, 0x7C35, 0x53D8,
+        0xF0A3, 0x8A4D, 0x991E, 0x7881, 0xC5CC, 0x146D, 0x323D, 0x1230, 0xEF36,
+        0xBFFD, 0x2B7C, 0xF296, 0x8D0F, 0x6AD0, 0x6E71, 0xEBFD, 0x1049, 0xE4B,
+        0xC0EE, 0xADB4, 0xA2A9, 0x42AC, 0x927F, 0x5E3C, 0x80BA, 0x786C, 0xF9D1,
+        0xC85B, 0x122F, 0x73C, 0xDE09, 0x8FD2, 0x28F6, 0x6F47, 0x8273, 0x11D5,
+        0x4D82, 0x6FDF, 0x9F58, 0xBD74, 0x7AE7, 0x3EE9, 0x3223, 0xCD3E, 0xE2D7,
+        0xCB05, 0x874B, 0x559E, 0x6B4C, 0xC46D, 0x3BFE, 0xEF90, 0xD15C, 0xF7A8,
+        0xF3FC, 0x6021, 0xD64, 0xB402, 0xB334, 0x6605, 0x2813, 0x46A1, 0x7F46,
+        0x65E3, 0x4E3E, 0x2C0C, 0x9817, 0x5C3F, 0x9A3B, 0x1B55, 0x2152, 0x951E,
+        0xB065, 0x8A3C, 0x64A3, 0xE5DB, 0x7C97, 0x167, 0x4DA5, 0xC9A7, 0x31BD,
+        0x7BEF, 0x7298, 0x641E, 0x9B14, 0xFF78, 0x5D01, 0xFA21, 0x8795, 0x5215,
+        0x8474, 0xFE96, 0x3640, 0x6625, 0xEF57, 0x5B6D, 0x527D, 0x3354, 0xE78D,
+        0xD532, 0xD5C2, 0x8F9A, 0xF4C8, 0xDE74, 0x5771, 0x3FF9, 0x2114, 0x2D8F,
+        0x3773, 0xD8AC, 0x1C7E, 0xEB7, 0xF4BF, 0xCD98, 0xF370, 0xCCCF, 0xA5D0,
+        0x4ECC, 0x10C7, 0xDD36, 0x429, 0xA401, 0x16F3, 0x1FB6, 0x8B2E, 0x1417,
+        0x80F6, 0x7523, 0xC70F, 0x7B62, 0x6D73, 0x73B3, 0xA169, 0x99F9, 0xCA98,
+        0x903A, 0xE34F, 0xEAF4, 0xC9F8, 0x930F, 0xB595, 0x8879, 0x641E, 0xB91D,
+        0x5F01, 0x6A20, 0xDF50, 0xBE13, 0x8458, 0x10F9, 0xCEC2, 0xB013, 0x8D95,
+        0x639B, 0x92C4, 0xE5C, 0x7BA0, 0xF3D4, 0x5068, 0xB689, 0x8285, 0xFCE7,
+        0xF10, 0xF661, 0xCDD1, 0xA0E5, 0xF42A, 0x1244, 0xE321, 0xFF03, 0x82CA,
+        0x4D04, 0x5479, 0x3F, 0x3B66, 0x2640, 0xB14, 0x2E54, 0xD218, 0x82F9,
+        0x6EF7, 0x525D, 0x5A2, 0x7D3E, 0x4255, 0xB446, 0x5F8C, 0xE0FA, 0x8C42,
+        0x47AD, 0x2C58, 0xC316, 0x4033, 0x4894, 0x42EB, 0x54B8, 0xFDC3, 0x453D,
+        0xAD5B, 0x3373, 0xEF97, 0x9C72, 0xC8C0, 0xE0E8, 0x1C6F, 0x986E, 0xEC89,
+        0x5C3C, 0x8EF9, 0x663C, 0xEACA, 0x8688, 0x8389, 0x49CB, 0xA6F1, 0x6DF1,
+        0x958D, 0x9EC5, 0x5387, 0xBDFD, 0xF9E0, 0xB01A, 0x69D, 0xC66C, 0xC9B2,
+        0x8E63, 0x1D06, 0xAF5B, 0xDBFF, 0x5FC0, 0xC358, 0x9754, 0xDC03, 0x5703,
+        0x895B, 0xA2C1, 0xB6EE, 0x299A, 0x6151, 0x663B, 0x8622, 0x24C2, 0xA336,
+        0xEB73, 0x54DB, 0xC80E, 0x239E, 0xCEE0, 0xD612, 0x595D, 0xA26B, 0x5FED,
+        0xABBC, 0x4C0E, 0xD854, 0x3544, 0x96EC, 0xEB9B, 0x3A24, 0xAD78, 0x4C2B,
+        0xF3CC, 0xD556, 0xD7FD, 0x842B, 0x7DCE, 0x8270, 0xF0EA, 0xEF51, 0x71BE,
+        0x767D, 0x3199, 0xCBAF, 0x4932, 0x7B83, 0x2AB3, 0x7F4C, 0x9885, 0xC5CC,
+        0x578D, 0x7F84, 0x6567, 0xFC56, 0xE231, 0x685F, 0xD820, 0xBC9E, 0x5134,
+        0x6FD7, 0xE61F, 0x8669, 0xE1FC, 0x34BB, 0xA5B1, 0xA202, 0x8B3E, 0x3E15,
+        0x697F, 0x6FF, 0x4A5B, 0xBD34, 0xAFCF, 0xD2BB, 0x1E56, 0x6613, 0x7BEC,
+        0xCDD6, 0x5FAC, 0xD2C, 0xC719, 0x802D, 0xA90A, 0xCA11, 0x2AD6, 0xD146,
+        0xD682, 0x3A88, 0xDF05, 0xE37D, 0xDF8B, 0x5344, 0xF7DF, 0x8219, 0x4626,
+        0x905A, 0x4237, 0xC9EC, 0x2AD5, 0x64CD, 0xC4F, 0x523D, 0xB25F, 0x5961,
+        0x3C9D, 0x7CAD, 0xC10E, 0x8382, 0x6E3F, 0x59B9, 0x8CC8, 0xD27, 0x91DD,
+        0x4A68, 0x5985, 0x1335, 0x4AD9, 0xD64D, 0x61A3, 0x6291, 0xB566, 0x55F1,
+        0x656E, 0xA71C, 0xA4DC, 0xB22D, 0xCB89, 0xB36, 0xA019, 0xD740, 0x67C7,
+        0x7500, 0x9406, 0x5813, 0x736F, 0x934B, 0x6142, 0x2487, 0x81B8, 0xD904,
+        0x74A2, 0xA060, 0x9B4F, 0xEB91, 0xE6A3, 0x272E, 0xF606, 0x9B6A, 0x2F8A,
+        0xA5BD, 0x467A, 0x9051, 0x8844, 0xD22F, 0xE34E, 0x9CEF, 0x3DCA, 0xECDA,
+        0x8EBC, 0xF42E, 0x5A93, 0x30BD, 0x9C25, 0x152C, 0x3721, 0xB859, 0x2B7E,
+        0xC3B7, 0xE935, 0xB0FB, 0x568F, 0x8438, 0x1030, 0xCDC5, 0x5C10, 0x3072,
+        0xB88E, 0x7F66, 0x72CE, 0xB423, 0x4FE, 0x187D, 0x345B, 0x2AED, 0x8484,
+        0xB386, 0x7B1, 0x4DBC, 0xACAC, 0x800B, 0xAB9A, 0x88E5, 0xD014, 0xCCD6,
+        0xEFEC, 0x2916, 0xDFE7, 0x313, 0xAFDB, 0x9469, 0xD446, 0xD610, 0x8C85,
+        0x407C, 0x78C2, 0x3678, 0x8891, 0x108B, 0xBFCE, 0x3FCE, 0x723, 0xA181,
+        0xA79C, 0xB6C6, 0xE4D5, 0x3CCD, 0x9910, 0x2F83, 0xBF44, 0x3DE3, 0xA300,
+        0xC47C, 0x9AB6, 0x2C66, 0x2BD, 0x149D, 0x664C, 0x10D4, 0xDDA6, 0x40DB,
+        0x5F4B, 0x6960, 0x2910, 0x4327, 0x40D2, 0x41E1, 0x646C, 0x6AA0, 0xBE13,
+        0xA761, 0xE830, 0xA91A, 0x2123, 0x37D6, 0x9C39, 0xC7, 0xE726, 0xE6E8,
+        0xD275, 0x1C48, 0x1175, 0x92B3, 0xBF50, 0xA13E, 0xB66D, 0x304, 0xB829,
+        0x6E90, 0x3E6, 0x22A4, 0xE6C7, 0xC338, 0x57B3, 0xA6E4, 0x3CBF, 0x1241,
+        0xE7A1, 0xB423, 0xA10B, 0x2D80, 0xFAAF, 0x24E1, 0x3CE7, 0x7D99, 0x122C,
+        0xA108, 0x6C14, 0x7F45, 0x125F, 0xD091, 0xAB5D, 0xB1B5, 0x21A0, 0x4C04,
+        0xEE11, 0x6727, 0x1D0D, 0x285B, 0xBB1A, 0x16F, 0x9A03, 0x2B97, 0x5034,
+        0xF2B4, 0xD35, 0x6A44, 0xE9C1, 0x8711, 0xFCDB, 0x1DE1, 0x74FD, 0xAAE6,
+        0xC8F8, 0xF9F2, 0x598, 0x3216, 0xB976, 0xCC6E, 0x84FE, 0xAC35, 0xF6C7,
+        0x5BBF, 0xA4CE, 0x2698, 0x3133, 0x1F02, 0x98AA, 0x9434, 0xA835, 0xC38F,
+        0xA62, 0x61D5, 0x9C13, 0x96B8, 0xD911, 0x847B, 0x176E, 0x4CD2, 0xD2BE,
+        0x32BB, 0x24E5, 0x442E, 0xE8F5, 0x4BFB, 0xA0D2, 0x9707, 0x5997, 0xC5C7,
+        0xD042, 0x65B1, 0xE0EE, 0x8943, 0x799C, 0xF58F, 0x333E, 0x83FF, 0x56DE,
+        0xFA90, 0x4BAB, 0x1380, 0x5462, 0xDF72, 0xA753, 0x6CEA, 0x3DC5, 0xCD01,
+        0x54FF, 0xFF3D, 0x751A, 0xA6A0, 0x62E6, 0xD4CF, 0xD6E0, 0x4E13, 0x5624,
+        0xCB71, 0x89B1, 0x8FEF, 0x5763, 0xE499, 0x5644, 0x3D0A, 0x9CB0, 0x5D4E,
+        0xAD27, 0x45E2, 0x6F01, 0x7E32, 0x44FE, 0x8713, 0xB667, 0x4D7F, 0xFD89,
+        0x3F4B, 0x96EF, 0x793C, 0x818, 0x65CE, 0x7F18, 0x20DB, 0xFAF8, 0xFCBF,
+        0x1F83, 0x9366, 0x92DB, 0x2F35, 0xE868, 0xB9D6, 0xE39C, 0xFDD9, 0xF5B0,
+        0x1DCF, 0x9B3, 0x7D19, 0x1969, 0x4C40, 0xC231, 0x3552, 0x886C, 0xB55C,
+        0x3C91, 0xC575, 0x89B, 0xAFE4, 0x81C, 0xE34F, 0xE0CE, 0x4F23, 0x4811,
+        0xC328, 0xFD66, 0x24BF, 0xD697, 0xB10D, 0x62C7, 0x76F6, 0xF1DC, 0xBA64,
+        0xB071, 0x3057, 0x4490, 0x9A65, 0x4E4E, 0xDFE4, 0xA8B7, 0x1137, 0xA80B,
+        0xD2EA, 0x724E, 0xDEF8, 0xAB79, 0x894E, 0xDE72, 0xA78D, 0x499E, 0x1773,
+        0x9C0F, 0x596, 0xBD14, 0xB42D, 0x88B3, 0x3AF6, 0x7896, 0xA5B2, 0x895F,
+        0x3904, 0xAC71, 0xD740, 0x5DB4, 0x3A81, 0x78B3, 0x8CDB, 0x772C, 0x8722,
+        0x8C65, 0x1996, 0x25FD, 0x70F0, 0xD9B1, 0xBC68, 0xC1EF, 0x74D8, 0x6C82,
+        0xB1E7, 0x4E3A, 0xC1C7, 0x82C4, 0x64C2, 0xB7CD, 0x7234, 0x82CC, 0x2831,
+        0x3DF8, 0xCF60, 0x953C, 0xBAFF, 0x2DDA, 0xDB27, 0xB34B, 0xD39, 0x7560,
+        0x9613, 0xEC06, 0xE68E, 0xA529, 0x110D, 0x28C8, 0x71CD, 0xB3B0, 0x5E4,
+        0x8C51, 0xF3C2, 0x4257, 0x5056, 0x4E02, 0x654B, 0x373A, 0x984A, 0xAEB6,
+        0xB723, 0xD908, 0xBFF3, 0x9944, 0x7FB5, 0x88B6, 0x9F43, 0x7662, 0xE81B,
+        0x1F05, 0x8F82, 0xBB61, 0x56F8, 0xCA43, 0xC35C, 0x1224, 0xDE7C, 0x5C0A,
+        0x8329, 0x88D5, 0x1F67, 0xA404, 0x10D5, 0x2543, 0x3D9, 0x47CA, 0xAD51,
+        0x9887, 0xF70, 0x52E7, 0xF19E, 0x1A6E, 0xED6F, 0x2DCB, 0x79D3, 0x1E,
+        0x974C, 0x203, 0x324E, 0x177C, 0x9C50, 0xDDBD, 0x780A, 0x8E28, 0x893D,
+        0xCBD3, 0x9CBC, 0x3F0F, 0xBE42, 0xF370, 0x5D5F, 0x1D09, 0x60C8, 0x4A3D,
+        0x56FF, 0x3A88, 0xE859, 0x16CA, 0x8BBD, 0x95A5, 0x6062, 0xFEB2, 0x5166,
+        0xCD14, 0x8187, 0x294A, 0x2280, 0x1FF9, 0x5644, 0x7284, 0x2140, 0xD803,
+        0x4099, 0xCF32, 0x3B18, 0xF525, 0x7D9B, 0x2C06, 0x8933, 0xA6E9, 0x7CE3,
+        0xB6EB, 0x3A3A, 0x2F9C, 0xC485, 0x8C83, 0x40C0, 0xBDDA, 0x4CE6, 0xE499,
+        0xDD05, 0xF70D, 0x155F, 0x72A3, 0x1509, 0xECBF, 0x9F0, 0x9FA2, 0xA39,
+        0x23BF, 0xA032, 0x1ECC, 0xCF97, 0xCE57, 0xECAA, 0x81B1, 0x43DE, 0xCCA1,
+        0x7FFA, 0x99EB, 0x2F88, 0x410A, 0x55B9, 0xD20F, 0xC09C, 0x3FE0, 0x18C6,
+        0xF3CC, 0xCAA9, 0x598A, 0x66CF, 0x1AEF, 0xEE01, 0x6858, 0x7493, 0xB709,
+        0xC101, 0x955C, 0x208B, 0x4058, 0x107, 0x6BF2, 0x67D0, 0x427C, 0xF10,
+        0x5DE2, 0x9B66, 0x7482, 0x23EF, 0x61E3, 0xA0D, 0x1749, 0x6243, 0xB5AD,
+        0xBB70, 0x3DF7, 0xA0D3, 0x8F54, 0xD182, 0x35C0, 0x8796, 0xB0F9, 0x4F9D,
+        0x5A99, 0x8AEA, 0xB2B9, 0x523D, 0x3CEA, 0xA7C3, 0x29D9, 0x203, 0x42E0,
+        0x17EE, 0x93CB, 0x4146, 0xE8BD, 0xEC6C, 0xCE44, 0xF044, 0x6377, 0xAB2F,
+        0xDB6F, 0xF3B5, 0x4800, 0xE10, 0xC2F, 0x8007, 0x88CC, 0x1960, 0x240D,
+        0xF84F, 0x120B, 0x911, 0x3564, 0xE67, 0x1857, 0xF9FE, 0x5B3F, 0x3E4,
+        0x7550, 0xA9DC, 0x83F0, 0x6A24, 0x2B7, 0x4719, 0x20B4, 0x51A9, 0xB2D,
+        0xC556, 0xEDC6, 0x560, 0x3750, 0xEF72, 0xFC23, 0x20A9, 0xC531, 0x31,
+        0xCDB8, 0xC99B, 0xD544, 0x3738, 0x3D53, 0xAA67, 0x8D00, 0x205F, 0xA700,
+        0xDC20, 0x12C7, 0x8686, 0x1BD3, 0xB6E4, 0xB62E, 0x6903, 0x26B0, 0x6333,
+        0x983A, 0xE9E, 0x4A90, 0xF92F, 0x188F, 0x7A54, 0xCCC, 0xEDE2, 0xEA42,
+        0x57AE, 0x57D7, 0x3D03, 0x7A06, 0xA5A0, 0x1076, 0x8E03, 0x1C, 0x3A13,
+        0x52B8, 0x6597, 0x7FAA, 0x838A, 0xC2B2, 0xD14D, 0xA71C, 0x18BC, 0x6F6B,
+        0xD2AC, 0xCB85, 0x70A0, 0x9B68, 0xE73C, 0x71B, 0x774A, 0xB4CA, 0x5100,
+        0x35DD, 0xE8F5, 0x4110, 0xC45D, 0xA61C, 0xC3D8, 0x19FC, 0xBE92, 0x142,
+        0x6CF5, 0x31BF, 0x3DD6, 0x2403, 0x4408, 0x3942, 0x8A66, 0xC81C, 0xDBB1,
+        0x57C1, 0xCBE8, 0x7652, 0xCEA9, 0x3512, 0xD483, 0x66B1, 0xE5FA, 0x399A,
+        0x2DCB, 0x92A4, 0x54B7, 0xA321, 0xDCB2, 0xF2B, 0xCB68, 0x764, 0xE8F,
+        0xE6A9, 0xCF4F, 0x2C8E, 0x736C, 0xF979, 0xB79E, 0x501B, 0x24F6, 0xC5F6,
+        0xEEC2, 0xD2E8, 0xA08B, 0xFDF6, 0xE372, 0x917, 0x870A, 0x886C, 0x83F0,
+        0xC7A1, 0x31DD, 0xA656, 0x87BA, 0xF88, 0x1310, 0x386F, 0xB8E8, 0xE242,
+        0xF1AB, 0x565, 0x3C17, 0xBC1, 0xAE83, 0xE97E, 0xC8D2, 0x67E1, 0xDFFE,
+        0x4AEB, 0x9C75, 0xC1C1, 0xE6D6, 0x3E53, 0x7D2E, 0x268F, 0x8E68, 0xBDF,
+        0x79FF, 0xEF6F, 0x76FE, 0xFBFB, 0x6878, 0xB51B, 0xDBAB, 0x3DA, 0x3FA2,
+        0x27FB, 0xDB1B, 0xFA9C, 0x640D, 0x7561, 0xD0D7, 0x7C38, 0x38FE, 0x10A7,
+        0xC906, 0xE44D, 0x60F, 0x3583, 0xEC89, 0xDA09, 0x2025, 0x1620, 0x9C03,
+        0x7CF0, 0xF423, 0x4D8F, 0xFC47, 0x25E3, 0xD03D, 0xC644, 0xD486, 0xFD80,
+        0xC194, 0x9EE6, 0xF27F, 0xDD21, 0x9911, 0x6379, 0xA5A5, 0x978A, 0x389E,
+        0x94D1, 0xB1CE, 0x3F2F, 0xCECE, 0xC2EB, 0x9E57, 0x505, 0x369E, 0xAEBC,
+        0xC012, 0xD764, 0x308E, 0x144, 0x4ED0, 0xA7C, 0xA3EF, 0xF32C, 0x426E,
+        0x5936, 0x8048, 0xDE6B, 0xB690, 0x12C, 0x7AAE, 0x1877, 0x9EFC, 0x62D5,
+        0x458F, 0xF972, 0x4019, 0x3A9, 0xF8E7, 0x5213, 0xE948, 0xD1C8, 0xE25,
+        0xFF46, 0x95AC, 0x7766, 0x9D02, 0x4121, 0x3DD5, 0xA3FE, 0x4A68, 0x6371,
+        0x5325, 0x5406, 0x1216, 0x75D1, 0xF341, 0x8543, 0x10BF, 0x1E80, 0x86B5,
+        0x9167, 0x345B, 0x28CF, 0xAABA, 0xDB9, 0x327D, 0xBCD4, 0x138, 0xE77C,
+        0x2CD9, 0x9D6E, 0xD7E6, 0x39F2, 0x9841, 0xA078, 0xCB85, 0xA47C, 0x95F4,
+        0xF122, 0x6014, 0x52C7, 0xB484, 0x5F4F, 0x162A, 0x28FA, 0xDDF2, 0xEEE7,
+        0xB6FC, 0x7BF1, 0x58FF, 0x6388, 0xE7F6, 0x42A4, 0xC084, 0xD6FC, 0xDF6C,
+        0xB163, 0x25F, 0xD510, 0xB4A, 0x1259, 0x5AB6, 0xAF7A, 0x693E, 0xD156,
+        0x4D97, 0x68B, 0x6042, 0x688D, 0x5A6C, 0x8A91, 0x789D, 0x31E3, 0x7252,
+        0x8611, 0x3D8A, 0x61DE, 0xED46, 0xE78C, 0x8028, 0x647, 0xBAC8, 0xE3F7,
+        0x8131, 0x42F3, 0x296A, 0x97A7, 0x6B25, 0xE242, 0xDEF5, 0xD0BE, 0xBA55,
+        0xA577, 0xA37C, 0xAF07, 0xCCAA, 0xEED0, 0xEAE2, 0xE19, 0xC639, 0xDA07,
+        0xC8A8, 0x846A, 0x8CCE, 0x865C, 0xC674, 0x1DE3, 0xEABC, 0xA3D5, 0xE53B,
+        0x175C, 0xF6A1, 0xC08E, 0x4521, 0x6E64, 0xBA75, 0xE665, 0x8B0, 0xA453,
+        0x2A9C, 0x3B40, 0xF820, 0xE705, 0xD0B8, 0x5932, 0x66A1, 0x67AC, 0x9FA2,
+        0xC6A9, 0x855C, 0xA5B1, 0x953C, 0x6294, 0x247A, 0x3BC3, 0x3E84, 0x44D,
+        0x5E2, 0x1859, 0x80FD, 0xD5BC, 0xF207, 0x27C, 0xD97E, 0x8EE4, 0x9B4A,
+        0xAF90, 0xBC11, 0xC7C7, 0xABF7, 0xAC89, 0xEC0F, 0xDF25, 0x5AC2, 0xF4FB,
+        0x44A4, 0x7051, 0x217D, 0x2217, 0x8B2C, 0x16E8, 0x296A, 0x9711, 0x9A23,
+        0x91EF, 0x1EFF, 0x391A, 0x78A4, 0x1D7, 0x99D4, 0x286A, 0x8AAD, 0x83F4,
+        0x6B66, 0xADCC, 0xE0CB, 0xE6AD, 0x6085, 0xC6BE, 0xE598, 0x5204, 0xFBF8,
+        0xA1E3, 0x6643, 0xEEE9, 0xB2EA, 0x36BF, 0xED42, 0xA9A8, 0xB6D4, 0xCC4,
+        0x764D, 0x586F, 0x553E, 0x9CB8, 0x15B4, 0x3F7F, 0xE348, 0xEBA0, 0xD505,
+        0xB732, 0x6053, 0x6F63, 0xB733, 0xC6A9, 0xC641, 0xF27, 0x561A, 0x947C,
+        0x97E9, 0x1472, 0xA867, 0x2157, 0xA15, 0x8644, 0x8995, 0x6084, 0x8398,
+        0x1A92, 0xBCFA, 0x2C37, 0x568B, 0x72DC, 0x85C4, 0x2B02, 0xBB39, 0xF8A1,
+        0x6540, 0x4023, 0x51A9, 0xA6DB, 0x406E, 0xFFD8, 0x76D7, 0xF6AC, 0x1AFB,
+        0xA2FA, 0x7F25, 0x43AE, 0xFA65, 0x3F4A, 0x4721, 0x4524, 0x4ECF, 0x232E,
+        0xBCAD, 0xE6DF, 0x51BC, 0x1379, 0xC778, 0x90C5, 0x1024, 0x5204, 0x9913,
+        0xFAD6, 0x2663, 0x7BD1, 0x36C7, 0x5B5F, 0x847, 0xF0DC, 0x124C, 0xB7BC,
+        0x2B62, 0xF5FA, 0x2620, 0x4111, 0xF745, 0x78E5, 0xEF61, 0xFA2E, 0x3C3D,
+        0xB927, 0x91C9, 0x699, 0x8888, 0xECBE, 0xC641, 0x1BF0, 0x5558, 0x5E4E,
+        0x2B31, 0x8571, 0xEF7F, 0xC39, 0xADC2, 0x1691, 0xEE78, 0x3D04, 0x10B4,
+        0x9C7B, 0x4EAB, 0x19DF, 0x4CBF, 0xB125, 0x15D3, 0x6A4F, 0x79AB, 0x5EA0,
+        0x2949, 0xB585, 0x9239, 0x63A7, 0xBF6F, 0xA7B3, 0xE81D, 0x604C, 0x5298,
+        0x548C, 0x62F5, 0x5204, 0xC030, 0x4501, 0xB463, 0x1BBC, 0x907, 0x35FB,
+        0x1037, 0x4CEC, 0x214A, 0xFDA9, 0xF241, 0x2416, 0x3C5F, 0x5204, 0x1B2,
+        0xDCBF, 0xE09B, 0xCA5A, 0xAF40, 0xF1E2, 0xEE35, 0x4DA1, 0x2166, 0xBF2,
+        0x792B, 0x9E0F, 0xBF12, 0xC664, 0x6E9A, 0x67BE, 0x306A, 0x6F4D, 0xC7DA,
+        0xFBA8, 0xED25, 0x70D7, 0x8526, 0xB093, 0xC641, 0xFED9, 0xA319, 0xEE45,
+        0x6C31, 0xC2CC, 0x4947, 0xCAE2, 0x3452, 0x8F9C, 0x9310, 0xE9FC, 0x8A19,
+        0xA205, 0x127D, 0xEDC4, 0x51CC, 0xD8B4, 0x30F6, 0x1CB7, 0x1650, 0x5204,
+        0xCD72, 0xAA7B, 0xC675, 0x8739, 0xD089, 0x6974, 0xF475, 0xEE0B, 0x3194,
+        0x2503, 0xC71C, 0x5204, 0xF5B9, 0x1B76, 0xDF93, 0xBD02, 0xDA4B, 0xE4B3,
+        0xC8F3, 0x84DF, 0x7281, 0xCC45, 0xC43C, 0xBE8C, 0x74A3, 0x5204, 0xD01E,
+        0xAC86, 0x5E28, 0xE0E3, 0x3DC4, 0x90CC, 0x47DD, 0x7123, 0xC15E, 0xED11,
+        0xDB63, 0x9E0F, 0x5B97, 0xF51D, 0x8EA8, 0x5689, 0x4B30, 0x655D, 0xD1BD,
+        0xA1EE, 0x76DA, 0x71E2, 0x39AC, 0x5291, 0xC641, 0x9637, 0x69BF, 0xF23D,
+        0x88C4, 0x8982, 0x9A47, 0xC107, 0x1185, 0xD716, 0x8784, 0x217A, 0x24C9,
+        0x67FB, 0x61C9, 0x91A5, 0xD8F0, 0x9FC9, 0xF707, 0x4E77, 0xA240, 0x5204,
+        0xA6F, 0x6693, 0xF797, 0xD3A5, 0xB393, 0xD916, 0xAEFD, 0x7B14, 0x1FF7,
+        0xAAC9, 0xE999, 0x5204, 0xAAE2, 0x9170, 0x2264, 0x6A6B, 0x875E, 0x5E3,
+        0x6934, 0x814D, 0xA90F, 0x6E1, 0x5EF8, 0x705B, 0x3C5F, 0x5204, 0x508F,
+        0xFA7B, 0x5767, 0x6E8A, 0x41B, 0x9A3B, 0xFDF3, 0x1318, 0x7740, 0xCF95,
+        0xF264, 0x9E0F, 0x5B97, 0x5D34, 0x48A2, 0x9CF1, 0xA164, 0x7A45, 0x3304,
+        0x557, 0xECEB, 0x12EF, 0x3929, 0x8D4C, 0xC641, 0x36BE, 0x7B8F, 0x65BE,
+        0x98F8, 0x58B8, 0x3C5A, 0x141A, 0xADC2, 0x86BB, 0x84BC, 0x435B, 0x10F6,
+        0x7DDF, 0xD5F3, 0x4B8D, 0x27D3, 0x2A61, 0x3D11, 0x31E8, 0xD988, 0x5204,
+        0xF838, 0xD8D5, 0x8AA, 0x5A88, 0xA418, 0x5DF0, 0x956D, 0x9AF2, 0xF95D,
+        0x6CDF, 0xF7C8, 0x5204, 0x3CC5, 0xBDC7, 0x56D1, 0x90E3, 0xBE52, 0xFCE,
+        0x744F, 0x85A0, 0xEA80, 0x822F, 0x989B, 0x8441, 0x98EA, 0x26AB, 0xCB35,
+        0x7E93, 0x1548, 0xB516, 0xFD3A, 0x1C6A, 0x360C, 0x91E, 0x8BCE, 0x8421,
+        0xF5D7, 0x5204, 0xC64A, 0x96AD, 0x1BD4, 0xDB11, 0xEDC7, 0x7FB0, 0x66E3,
+        0x57D5, 0x48C3, 0x7DC1, 0x5DC6, 0x33A5, 0xC641, 0x1999, 0xA5D0, 0x4CF9,
+        0xCEAD, 0xBCCE, 0xB8A2, 0xB181, 0x800, 0xA51F, 0x5ABF, 0x3128, 0x10BA,
+        0xF5FD, 0x6F93, 0xCFB2, 0x3A8B, 0x3F39, 0x334D, 0xF491, 0x39BD, 0x5204,
+        0x208B, 0xCE17, 0x68F8, 0xB577, 0xE19D, 0xF6B8, 0xF5E1, 0xE439, 0xB76D,
+        0xC5B, 0x8B30, 0x5204, 0x78E, 0xF535, 0x9FB, 0x8FAA, 0x1DD3, 0xC32B,
+        0xC4E4, 0xF74E, 0xBBF2, 0x6C45, 0x9716, 0xD2EC, 0xE8D1, 0xD56C, 0x4774,
+        0x42F1, 0x510F, 0x55A6, 0xFF4E, 0xC84, 0x635D, 0x49A4, 0x5F5E, 0xF24A,
+        0xAB0F, 0x5204, 0x7761, 0x861A, 0x4B58, 0x8026, 0x4F9F, 0xDB7E, 0xC5AD,
+        0xF7DC, 0x5831, 0x9A27, 0xD832, 0x9479, 0x35B0, 0x7CE9, 0xF529, 0x9077,
+        0xF476, 0xAF8C, 0xE7C7, 0x1F97, 0x8ED2, 0xE966, 0x2009, 0xD773, 0x5204,
+        0x352A, 0x7466, 0x28A7, 0xC224, 0xE91E, 0x8EC0, 0x6D20, 0xE468, 0xC641,
+        0x3207, 0x8080, 0x276D, 0x9CFE, 0x7A1A, 0x9318, 0xECCD, 0xD27, 0x4EB3,
+        0xE576, 0xF171, 0xF3F1, 0x29B4, 0x6A09, 0xF227, 0x8AA4, 0x1639, 0xBFAB,
+        0xC270, 0x162B, 0xC5A7, 0xBD58, 0xFEBC, 0x1048, 0x797D, 0x9BB3, 0xE9DD,
+        0xEEFE, 0x1109, 0xD2ED, 0x49FF, 0x3AD5, 0x7B3A, 0x45FD, 0xE060, 0x24C9,
+        0x40AA, 0x5204, 0x1B1, 0x8C04, 0xAA89, 0xDF93, 0xC0AC, 0x93C5, 0xF2F6,
+        0x176C, 0x8AA9, 0x4FD7, 0x47CE, 0x14FF, 0x8920, 0xBEC7, 0x78F6, 0xE22D,
+        0x9AE6, 0x5F0D, 0x8231, 0xC3CA, 0xC1BB, 0x21BF, 0xEBF7, 0x9AF3, 0x5204,
+        0x7EE4, 0xE270, 0xFE01, 0x216, 0x3AE8, 0xEC9A, 0x6C7F, 0x5B28, 0xE2D5,
+        0xEE31, 0x297F, 0x9951, 0x3209, 0x1F2C, 0x4897, 0x4D00, 0x8E04, 0xC9B5,
+        0x4C7A, 0x59DB, 0xC3CB, 0x7BA2, 0xB3F, 0xBD19, 0x5B47, 0x608E, 0x798B,
+        0x849C, 0x8811, 0xD73B, 0x9889, 0x3857, 0xEF62, 0xE78B, 0xC641, 0x67B0,
+        0xE62A, 0x82F6, 0xAB64, 0x527A, 0x6C60, 0x45E0, 0x16B, 0xABE0, 0x81F4,
+        0xEFA3, 0x5204, 0xC0A0, 0xD899, 0x9423, 0x747, 0x74E4, 0x6AD9, 0xD0F7,
+        0x44BE, 0x23C5, 0x716B, 0xFB27, 0xC50A, 0xC641, 0x9618, 0x7022, 0x7BAF,
+        0xD3A2, 0x9880, 0x45F, 0x33A0, 0x2A20, 0x3116, 0xB47D, 0xED58, 0x67F3,
+        0xEE91, 0x73DD, 0x86, 0x4D26, 0xC86E, 0x781F, 0x131F, 0xF484, 0x5204,
+        0x8615, 0x5D12, 0xBE0D, 0x83E8, 0x3DD7, 0x33D1, 0xD15F, 0xBAC1, 0x36B2,
+        0x34B4, 0xB767, 0x5204, 0x6A29, 0xD4F8, 0x620F, 0xE6EE, 0xB655, 0x6F23,
+        0xB826, 0x9571, 0xE95, 0xABBF, 0x8FAB, 0xE256, 0x551B, 0xE261, 0xCCE7,
+        0x8957, 0x862B, 0x33F2, 0x315D, 0x4887, 0x193B, 0xA78C, 0xFC9E, 0x8BDC,
+        0x5D84, 0x5204, 0x31AD, 0x9BF6, 0x2BA0, 0xCF08, 0x2114, 0xF109, 0x99C8,
+        0xE387, 0xAA19, 0x8290, 0x1AEF, 0x4514, 0x33B8, 0xC278, 0xDA8D, 0x7D40,
+        0xE8C, 0xA86C, 0x9F0D, 0xEFC5, 0xA7AA, 0xFF96, 0x88FE, 0xBF90, 0x5204,
+        0xC30A, 0xCE32, 0x8058, 0x9E3, 0x56D2, 0x9C32, 0xCA24, 0x4784, 0x35B0,
+        0x1A70, 0xC275, 0x1AD8, 0xDF80, 0x5913, 0xED39, 0x373C, 0xEEBC, 0xBA9C,
+        0x5B77, 0x1C36, 0xDF8F, 0x50D7, 0x97A, 0x34E1, 0x73C3, 0x28F7, 0x56B4,
+        0xA5AA, 0xB890, 0xFC39, 0xA226, 0x3400, 0x56E8, 0x4DD2, 0xA8E9, 0x3196,
+        0x1394, 0x5204, 0x1A76, 0xC8A, 0x195D, 0x3EAC, 0xF193, 0xD31, 0x56DF,
+        0x91D2, 0x5204, 0x10C, 0x52B6, 0x2C2B, 0x9368, 0xB43C, 0xA27B, 0x7541,
+        0xE40D, 0x1C9D, 0xA3D7, 0xC809, 0x43AE, 0x553E, 0x8A1, 0x678D, 0xE97B,
+        0x858A, 0x687C, 0xDE62, 0x1423, 0xD6D7, 0x37B4, 0x177D, 0xFF3F, 0x5204,
+        0x6405, 0x334B, 0x9FB4, 0x1C2D, 0x9DE5, 0xC995, 0x8A2B, 0x8D4C, 0x54E3,
+        0xA8B, 0x297E, 0x9D07, 0x5014, 0xF245, 0xBBB5, 0x115C, 0xEEE3, 0xA7F5,
+        0x5431, 0x81F8, 0x5204, 0x743B, 0x72E9, 0x7E15, 0x9E1B, 0x85B8, 0x8BDC,
+        0x6245, 0x1F7F, 0xF95D, 0x2B02, 0x82B8, 0xAB50, 0x787D, 0xE0AA, 0x54CA,
+        0xA0DA, 0x5204, 0xC936, 0x6570, 0x7C2E, 0xCB6, 0x60C, 0x5039, 0xDD30,
+        0x5B25, 0xD56C, 0x71EB, 0x3407, 0x732F, 0x76C5, 0xB1AE, 0x1331, 0x143C,
+        0xFD73, 0x2D53, 0xCBD5, 0xCC98, 0x5204, 0xA71A, 0x809A, 0xC12E, 0x1A8E,
+        0xBCC6, 0xD710, 0x4EA5, 0x7632, 0xCDE0, 0x56E8, 0x7B13, 0x4A6B, 0x4D9B,
+        0x4FB1, 0x3BB, 0x9FAE, 0xEE39, 0x5182, 0x41DD, 0x5BED, 0xA62C, 0x482F,
+        0xD9D8, 0xD275, 0x5204, 0x918, 0xE736, 0x4F43, 0xF115, 0xABC2, 0xC112,
+        0x9E54, 0x4957, 0x5204, 0xEB6A, 0xDEF3, 0xA0C4, 0xD801, 0x8F4C, 0x2835,
+};
+
+const uint16_t nr_golden_hashes = sizeof golden_hashes/sizeof golden_hashes[0];
@@ -0,0 +1,43 @@
+// layout.h
+//
+// The physical layout of the strips, see Geometry.h. This is the one place
+// to change for a different installation.
+//
+// Ours is two tables end to end, 4m long and 1m wide all together, with the
+// strips running under the edge of the table top: strips 0-3 down one long
+// side, and strips 4-7 back up the other. Each strip is 1m of 144 LEDs,
+// which take their data in blue/green/red order.
+// Coordinates are in mm, with the origin at the corner where strip 0 starts.
+
+#pragma once
+
+#include "Geometry.h"
+
+#include <Adafruit_DotStar.h>
+
+struct TableLayout
+{
+        static constexpr uint8_t nr_strips = 8;
+        static constexpr uint16_t leds_per_strip = 144;
+        static constexpr uint8_t color_order = DOTSTAR_BGR;
+
+        // the middle of the tables, which angles and radii are measured
+        // around
+        static constexpr int16_t center_x = 2000;
+        static constexpr int16_t center_y = 500;
+
+        static constexpr StripRun runs[nr_strips] = {
+                {0, 0, 1000, 0},
+                {1000, 0, 2000, 0},
+                {2000, 0, 3000, 0},
+                {3000, 0, 4000, 0},
+                {4000, 1000, 3000, 1000},
+                {3000, 1000, 2000, 1000},
+                {2000, 1000, 1000, 1000},
+                {1000, 1000, 0, 1000}
+        };
+};
+
+constexpr StripRun TableLayout::runs[];
+
+using TableGeometry = Geometry<TableLayout>;
@@ -41,8 +41,33 @@
 // to be roughly 6A.
 
 
+// uncomment to get timing marker pulses on pins 22-25, see ScopeMarker.h
+// #define LED_MONGER_SCOPE_MARKERS
+
+#include "Console.h"
+#include "ConsoleCommand.h"
+#include "DmxReceiver.h"
+#include "FastBoot.h"
+#include "FrameSync.h"
+#include "FrameTimeHistogram.h"
+#include "FrameTracker.h"
+#include "GoldenCheck.h"
+#include "InputTrace.h"
+#include "LedOutput.h"
 #include "LedProgram.h"
+#include "OpcReceiver.h"
+#include "PortOutput.h"
+#include "QualityGovernor.h"
+#include "RamMonitor.h"
+#include "Recording.h"
 #include "RotaryEncoder.h"
+#include "ScopeMarker.h"
+#include "SettingsLog.h"
+#include "StageProfiler.h"
+#include "StripScheduler.h"
+#include "golden_hashes.h"
+#include "layout.h"
+#include "programs.h"
 
 #include <Adafruit_DotStar.h>
 #include <Adafruit_LEDBackpack.h>
@@ -50,20 +75,45 @@
 using pinno_t = const uint8_t;
 
 // we have 8 physical LED strips, each with 144 LEDs per strip, that accept
-// data in blue/green/red order.
-const uint16_t nr_strips = 8;
-const uint16_t leds_per_strip = 144;
-const uint8_t led_color_order = DOTSTAR_BGR;
+// data in blue/green/red order. How many strips there are, where they are and
+// their color order is described in layout.h.
+const uint16_t nr_strips = TableLayout::nr_strips;
+const uint16_t leds_per_strip = TableLayout::leds_per_strip;
+const uint8_t led_color_order = TableLayout::color_order;
 
 // each LED strip has its own digital pins for its SPI clock and data
-pinno_t led_clk_pins[nr_strips] = {
+constexpr pinno_t led_clk_pins[nr_strips] = {
         52, 50, 48, 46, 44, 42, 40, 38
 };
 
-pinno_t led_data_pins[nr_strips] = {
+constexpr pinno_t led_data_pins[nr_strips] = {
         53, 51, 49, 47, 45, 43, 41, 39
 };
 
+static_assert(fast_boot::allStripPins(led_clk_pins, nr_strips)
+              && fast_boot::allStripPins(led_data_pins, nr_strips),
+              "FastBoot only knows the ports for pins 38-53");
+
+// the pin tables as port masks, worked out here so that they're constants by
+// the time fastBoot() uses them: it runs before the pin tables are copied
+// into RAM
+constexpr PinMasks clk_masks = pinMasks(led_clk_pins, nr_strips);
+constexpr PinMasks data_masks = pinMasks(led_data_pins, nr_strips);
+
+static_assert(!(clk_masks.b & data_masks.b) && !(clk_masks.d & data_masks.d)
+              && !(clk_masks.g & data_masks.g) && !(clk_masks.l & data_masks.l),
+              "a strip pin is both a clock and a data pin");
+
+// the first code of ours to run after reset, before the Arduino core, the
+// global constructors or setup(): get every strip dark. See FastBoot.h. It's
+// naked, so it has no prologue and mustn't have locals: just the one call.
+void fastBoot() __attribute__((naked, used, section(".init3")));
+
+void fastBoot()
+{
+        FastBoot::blank(clk_masks, data_masks, leds_per_strip);
+}
+
 // our LED strip. We only have one instead of nr_strips of these because we
 // don't have enough ram to store nr_strips (aka 8). We could probably do some
 // hacky thing where we put some of them in flash (PROGMEM), but that would
@@ -76,6 +126,91 @@ pinno_t led_data_pins[nr_strips] = {
 Adafruit_DotStar strip{leds_per_strip, led_data_pins[0], led_clk_pins[0],
                 led_color_order};
 
+// what we last sent to each strip. Most programs re-generate the same buffer
+// for a while (or for every strip), and bit-banging a strip that already
+// shows those pixels is pure waste.
+FrameTracker<nr_strips> frames;
+
+// set this to send the strips with PortOutput rather than the DotStar class.
+// It should be faster, but until that's been measured on the board (see
+// PortOutput.h) the DotStar class stays the default.
+const bool use_port_output = false;
+
+// set this to record every strip we send, and the inputs behind it, to
+// Serial2 (see Recording.h). To play a recording back, send it to Serial2
+// with player in live_inputs instead of opc.
+const bool record_frames = false;
+
+// how rendered strips leave the board, see LedOutput.h. To capture what the
+// strips are sent on a computer, point this at a TeeOutput of strip_output
+// and a StreamOutput on a spare serial port.
+//
+// port_output and dotstar_output send the same bytes. To see the pins
+// themselves, run "make vcd" in test/, which traces both on a computer and
+// writes a Value Change Dump (see test/vcd_trace.h).
+PortOutput port_output{led_data_pins, led_clk_pins, nr_strips};
+DotStarOutput dotstar_output{led_data_pins, led_clk_pins};
+LedOutput& strip_output = use_port_output ? (LedOutput&)port_output
+        : (LedOutput&)dotstar_output;
+RecordingOutput recorder{Serial2};
+TeeOutput recording_output{strip_output, recorder};
+LedOutput *output = record_frames ? (LedOutput *)&recording_output
+        : &strip_output;
+
+// live DMX input (E1.31 or Art-Net) from a lighting desk, forwarded to us
+// by a network bridge on Serial3 (pins 14 and 15), see DmxReceiver.h. Each
+// strip gets one universe, starting at universe 1 (Art-Net 0). If a strip is
+// ever split between universes, DmxReceiver needs shadow room for it.
+const unsigned long dmx_baud = 500000;
+
+const UniverseMapping dmx_universes[] = {
+        {1, 0, 0},
+        {2, 1, 0},
+        {3, 2, 0},
+        {4, 3, 0},
+        {5, 4, 0},
+        {6, 5, 0},
+        {7, 6, 0},
+        {8, 7, 0}
+};
+
+DmxReceiver dmx{Serial3, dmx_universes,
+                (sizeof dmx_universes)/(sizeof dmx_universes[0]), nr_strips};
+
+// Open Pixel Control from pattern generators on a computer, over a USB to
+// serial adapter on Serial2 (pins 16 and 17), see OpcReceiver.h. At this
+// rate bytes get lost while a strip is being shown unless the client paces
+// itself; OpcReceiver finds its place again after a loss, and "stats" counts
+// the losses.
+const unsigned long opc_baud = 1000000;
+
+OpcReceiver opc{Serial2, nr_strips};
+RecordingPlayer player{Serial2, nr_strips};
+
+// keeping frames in step with other boards, over Serial2, see FrameSync.h.
+// A leader sends its frames, a follower takes its program, inputs and frame
+// timing from the leader.
+enum SyncRole : uint8_t {
+        SYNC_NONE,
+        SYNC_LEADER,
+        SYNC_FOLLOWER
+};
+
+const SyncRole sync_role = SYNC_NONE;
+
+SyncLeader sync_leader{Serial2};
+SyncFollower sync_follower{Serial2};
+
+// add live inputs here. opc goes last: it shares Serial2 with frame sync, so
+// it's left out when we're syncing.
+LiveInput *live_inputs[] = {
+        &dmx,
+        &opc
+};
+
+const uint8_t nr_live_inputs = (sizeof live_inputs)/(sizeof live_inputs[0])
+        - (sync_role != SYNC_NONE ? 1 : 0);
+
 // analog pins for potentiometer taps
 pinno_t freq_pot_pin = 1;
 pinno_t brightness_pot_pin = 0;
@@ -83,29 +218,130 @@ pinno_t brightness_pot_pin = 0;
 // the display for which program we're on
 Adafruit_7segment seven_seg;
 
+// standard input traces for benchmarking, see InputTrace.h. Set bench_trace
+// to one of these to play it on startup; at the end of the trace we print the
+// distribution of frame times and go back to the real inputs.
+const TracePoint trace_static[] PROGMEM = {
+        {0, 512, 512, 3},
+        {10000, 512, 512, 3}
+};
+
+const TracePoint trace_slow_sweep[] PROGMEM = {
+        {0, 0, 1023, 2},
+        {30000, 1023, 1023, 2},
+        {60000, 0, 0, 2},
+        {60001, 0, 0, 2}
+};
+
+const TracePoint trace_prog_flip[] PROGMEM = {
+        {0, 700, 700, 0},
+        {250, 700, 700, 1},
+        {500, 700, 700, 2},
+        {750, 700, 700, 3},
+        {1000, 700, 700, 4},
+        {1250, 700, 700, 5},
+        {1500, 700, 700, 0},
+        {1750, 700, 700, 1},
+        {2000, 700, 700, 2},
+        {2250, 700, 700, 3},
+        {2500, 700, 700, 4},
+        {2750, 700, 700, 5},
+        {3000, 700, 700, 5}
+};
+
+struct BenchTrace
+{
+        const TracePoint *points;
+        uint8_t nr_points;
+};
+
+#define BENCH_TRACE(t) {t, (sizeof t)/(sizeof t[0])}
+
+const BenchTrace bench_traces[] = {
+        BENCH_TRACE(trace_static),
+        BENCH_TRACE(trace_slow_sweep),
+        BENCH_TRACE(trace_prog_flip)
+};
+
+// index into bench_traces, or -1 to just run normally
+const int8_t bench_trace = -1;
+
+InputTrace trace;
+FrameTimeHistogram frame_times;
+
+// the serial console, for live tuning and stats. Type "help".
+Console console{Serial};
+
+// how much we print as we go. Telemetry goes through the console, so if
+// there's more than the serial port can keep up with it gets dropped rather
+// than slowing frames down; it's also turned off while a trace plays.
+enum Telemetry : uint8_t {
+        TELEMETRY_OFF,
+        // a line per frame
+        TELEMETRY_FRAMES,
+        // and a line per strip, and the inputs
+        TELEMETRY_STRIPS
+};
+
+// off to start with: at 9600 baud even a line per frame nearly fills the
+// console's 256 byte ring, and then replies to commands get dropped too
+uint8_t telemetry = TELEMETRY_OFF;
+uint8_t telemetry_before_trace = TELEMETRY_OFF;
+
+// set this to check every program's output against golden_hashes.h on
+// startup, see GoldenCheck.h
+const bool golden_check = false;
+
+void runGoldenCheck();
+
+// the program and console overrides are saved to EEPROM once they settle,
+// and put back on startup, see SettingsLog.h
+SettingsLog settings_log;
+
+void restoreSettings();
+
 void setup()
 {
+        RamMonitor::paint();
+
+        // the strips went dark in fastBoot(), before we got here. Now come
+        // straight back up in the program we were running when the power
+        // went.
+        strip.begin();
+        if (use_port_output)
+                port_output.begin();
+        restoreSettings();
+
         seven_seg.begin(0x70);
         
         // for debugging
         Serial.begin(9600);
-}
 
-// add LED programs here
-BlinkerProg blinker;
-RgbBlinkerProg rgb_blinker;
-SingleColorProg single_color;
-ColorTempProg color_temp;
-
-LedProgram *progs[] = {
-        &blinker,
-        &rgb_blinker,
-        &single_color,
-        &color_temp    
-};
+        Serial2.begin(opc_baud);
+        Serial3.begin(dmx_baud);
+
+        if (golden_check)
+                runGoldenCheck();
+
+        StageProfiler::begin();
+        beginScopeMarkers();
 
+        if (bench_trace >= 0) {
+                trace.begin(bench_traces[bench_trace].points,
+                            bench_traces[bench_trace].nr_points);
+                telemetry_before_trace = telemetry;
+                telemetry = TELEMETRY_OFF;
+        }
+}
+
+// the LED programs are in programs.h
 uint8_t which_prog = 0;
-const uint8_t nr_progs = (sizeof progs)/(sizeof progs[0]);
+
+void runGoldenCheck()
+{
+        GoldenCheck::run(progs, nr_progs, strip, nr_strips, golden_hashes,
+                         nr_golden_hashes, Serial);
+}
 
 // interrupt pins for rotary encoder
 pinno_t rot_a_pin = 18;
@@ -116,64 +352,436 @@ RotaryEncoder rot{rot_a_pin, rot_b_pin, nr_progs};
 // switch pin for roatary encoder (currently unused)
 pinno_t rot_switch_pin = 32;
 
-void loop()
+// steps expensive programs' quality down when they miss their deadline
+QualityGovernor governor;
+
+// values set from the console, which win over the pots and the encoder. The
+// program override lasts until someone turns the encoder.
+const int16_t NO_OVERRIDE = ConsoleCommand::AUTO;
+int16_t prog_override = NO_OVERRIDE;
+int16_t freq_override = NO_OVERRIDE;
+int16_t brightness_override = NO_OVERRIDE;
+uint8_t encoder_pos = 0;
+
+// put back what settings_log saved last time, if anything
+void restoreSettings()
 {
-        unsigned long loop_start = millis();
-        
-        // we always want frequency to be at least 1, so add 1 to whatever we read.
-        uint16_t freq = analogRead(freq_pot_pin);
-        uint16_t brightness = analogRead(brightness_pot_pin);
+        Settings s;
+        s.prog = 0;
+        s.freq_override = NO_OVERRIDE;
+        s.brightness_override = NO_OVERRIDE;
+        s.telemetry = telemetry;
+
+        settings_log.load(s);
+
+        which_prog = s.prog % nr_progs;
+        encoder_pos = which_prog;
+        rot.setIndex(which_prog);
+        freq_override = s.freq_override;
+        brightness_override = s.brightness_override;
+        telemetry = s.telemetry;
+}
+
+// hand the current settings to settings_log, which saves them once they
+// stop changing. Traces aren't anyone's settings, so they aren't saved.
+void saveSettings(const unsigned long now)
+{
+        if (trace.active())
+                return;
+
+        Settings s;
+        s.prog = which_prog;
+        s.freq_override = freq_override;
+        s.brightness_override = brightness_override;
+        s.telemetry = telemetry;
+        settings_log.update(s, now);
+}
+
+// each frame is split into one task per strip, see StripScheduler.h
+StripScheduler<nr_strips> scheduler;
+
+// per-frame state. This is latched when a frame starts so that every strip
+// in a frame sees the same program and the same inputs. prog starts out NULL
+// so that the first program gets activated like any other.
+LedProgram *prog = NULL;
+uint16_t freq = 0;
+uint16_t brightness = 0;
+
+// frames started since boot, or the leader's frame number when following
+uint32_t frame_nr = 0;
+
+// freq summed over every frame up to and including this one, or the
+// leader's sum when following. With frame_nr it's the clock the programs
+// animate from, see LedProgram::clock().
+uint32_t freq_sum = 0;
 
-        unsigned long interval_millis = 1000UL/(freq != 0 ? log(freq): 1);
+// a live input wrote the strip buffer since the last strip was rendered,
+// so a program that re-uses strip 0 has to render it again, see showStrip()
+bool first_strip_lost = false;
 
+// how much time this frame has spent rendering and showing, which isn't the
+// same as how long it took, since loop() does other things between strips
+unsigned long frame_work_micros = 0;
+
+void startFrame()
+{
+        ProfileStage stage{StageProfiler::FRAME_START};
+
+        // we always want frequency to be at least 1, so add 1 to whatever we read.
+        freq = analogRead(freq_pot_pin);
+        brightness = analogRead(brightness_pot_pin);
         which_prog = rot.getPos();
-        
-        Serial.print("read freq=");
-        Serial.print(freq);
-        Serial.print(" brightness=");
-        Serial.print(brightness);
-        Serial.print(" prog=");
-        Serial.println(which_prog);
+
+        if (which_prog != encoder_pos) {
+                encoder_pos = which_prog;
+                prog_override = NO_OVERRIDE;
+        }
+        if (prog_override != NO_OVERRIDE)
+                which_prog = prog_override;
+        if (freq_override != NO_OVERRIDE)
+                freq = freq_override;
+        if (brightness_override != NO_OVERRIDE)
+                brightness = brightness_override;
+
+        const bool following = sync_role == SYNC_FOLLOWER
+                && sync_follower.locked(millis());
+        if (following) {
+                const SyncFrame& f = sync_follower.leader();
+                which_prog = f.prog % nr_progs;
+                freq = f.freq;
+                brightness = f.brightness;
+        }
+
+        if (trace.active()) {
+                if (trace.read(millis(), freq, brightness, which_prog)) {
+                        which_prog %= nr_progs;
+                } else {
+                        Serial.println(F("trace done"));
+                        frame_times.print(Serial);
+                        StageProfiler::print(Serial);
+                        telemetry = telemetry_before_trace;
+                }
+        }
+
+        // log(1) is 0, so readings of 0 and 1 both get a frame a second
+        // rather than a division by zero
+        unsigned long interval_millis = 1000UL/(freq > 1 ? log(freq): 1);
+
+        if (telemetry >= TELEMETRY_STRIPS) {
+                ProfileStage stage{StageProfiler::DEBUG_PRINT};
+                console.print(F("read freq="));
+                console.print(freq);
+                console.print(F(" brightness="));
+                console.print(brightness);
+                console.print(F(" prog="));
+                console.println(which_prog);
+        }
 
         seven_seg.println(which_prog, DEC);
         seven_seg.writeDisplay();
 
-        LedProgram *prog = progs[which_prog];
-
-        for (size_t i = 0; i < nr_strips; ++i) {
+        if (progs[which_prog] != prog) {
+                prog = progs[which_prog];
+                prog->activate();
+        }
+        ++frame_nr;
+        if (following)
+                freq_sum = sync_follower.freqSumAt(frame_nr);
+        else
+                freq_sum += freq;
+        LedProgram::startFrame({frame_nr, freq_sum});
+        recorder.frameStarted(which_prog, freq, brightness);
+        if (sync_role == SYNC_LEADER)
+                sync_leader.frameStarted({frame_nr, freq_sum, which_prog, freq,
+                                          brightness});
+        governor.frameStarted(prog);
 
-                if (i == 0)
-                        strip.updatePins();
-                else
-                        strip.updatePins(led_data_pins[i], led_clk_pins[i]);
+        frame_work_micros = 0;
+        scheduler.beginFrame(millis(), interval_millis);
+        ScopeMarker<SCOPE_FRAME>::high();
+}
 
+void showStrip(const uint8_t i, const uint8_t live_strips)
+{
+        unsigned long render_start = micros();
+        {
+                ScopeMarker<SCOPE_RENDER> mark;
+                ProfileStage stage{StageProfiler::RENDER};
+                if (first_strip_lost && i != 0 && prog->reusesFirstStrip())
+                        prog->updateStrip(strip, 0, brightness, freq);
+                first_strip_lost = false;
                 prog->updateStrip(strip, i, brightness, freq);
+        }
+        unsigned long render_time = micros() - render_start;
+        frame_work_micros += render_time;
+
+        // the DotStar class wants brighness in [0, 255]
+        // this math assumes maxBrighness > 255
+        strip.setBrightness(brightness/(prog->maxBrightness()/255));
+
+        // a live input has this strip. We still had to render it above,
+        // since the program may be relying on strips being updated in order.
+        if (live_strips & (1 << i))
+                return;
 
-                // the DotStar class wants brighness in [0, 255]
-                // this math assumes maxBrighness > 255
-                strip.setBrightness(brightness/(prog->maxBrightness()/255));
+        {
+                ProfileStage stage{StageProfiler::FRAME_CHECK};
+                if (!frames.needsShow(i, strip.getPixels(), 3*strip.numPixels(),
+                                      strip.getBrightness(), millis()))
+                        return;
+        }
 
-                unsigned long before = micros();
-                strip.show();
-                unsigned long after = micros();
-                Serial.print("show took ");
-                Serial.print(after - before);
-                Serial.println("us");
+        unsigned long before = micros();
+        {
+                ScopeMarker<SCOPE_SHOW> mark;
+                ProfileStage stage{StageProfiler::SHOW};
+                output->show(strip, i);
         }
+        unsigned long after = micros();
+        frame_work_micros += after - before;
 
-        // this sleep time isn't perfect because (1), we may be taking a lot of
+        if (telemetry >= TELEMETRY_STRIPS) {
+                ProfileStage stage{StageProfiler::DEBUG_PRINT};
+                console.print(F("render took "));
+                console.print(render_time);
+                console.print(F("us show took "));
+                console.print(after - before);
+                console.println(F("us"));
+        }
+}
+
+void finishFrame()
+{
+        // frame timing isn't perfect because (1), we may be taking a lot of
         // time to update the strips so we can't go at the desired frequency and
         // (2), the arduino runtime might do some stuff between calls to
-        // loop().
-        unsigned long loop_time = millis() - loop_start;
-        Serial.print("loop_time=");
-        Serial.print(loop_time);
-        Serial.print(" interval_millis=");
-        Serial.println(interval_millis);
-        if (loop_time < interval_millis) {
-                unsigned long sleep_time = interval_millis - loop_time;
-                Serial.print("sleep_time=");
-                Serial.println(sleep_time);
-                delay(sleep_time);
-        }                                      
+        // loop(). We don't sleep off the rest of the interval anymore, the
+        // scheduler just won't start the next frame until it's due.
+        ScopeMarker<SCOPE_FRAME>::low();
+        unsigned long frame_time = millis() - scheduler.frameStart();
+        frames.frameDone(frame_time, scheduler.interval());
+        governor.frameDone(frame_work_micros, 1000*scheduler.interval());
+        if (trace.active())
+                frame_times.add(frame_work_micros);
+
+        if (telemetry < TELEMETRY_FRAMES)
+                return;
+
+        ProfileStage stage{StageProfiler::DEBUG_PRINT};
+        console.print(F("frame_time="));
+        console.print(frame_time);
+        console.print(F(" interval_millis="));
+        console.print(scheduler.interval());
+        console.print(F(" shown="));
+        console.print(frames.shown());
+        console.print(F(" repeated="));
+        console.print(frames.repeated());
+        console.print(F(" dropped="));
+        console.print(frames.dropped());
+        console.print(F(" deadline_misses="));
+        console.print(governor.misses());
+        console.print(F(" quality="));
+        console.println(governor.level());
+}
+
+// steer our frame clock towards the leader's. Only between frames, so a
+// frame in progress keeps its frame number and start time.
+void followLeader(const unsigned long now)
+{
+        sync_follower.poll();
+        if (!scheduler.idle())
+                return;
+
+        bool restart;
+        long slew = sync_follower.correction(frame_nr, scheduler.frameStart(),
+                                             scheduler.interval(), restart);
+        if (restart) {
+                frame_nr = sync_follower.leader().frame - 1;
+                scheduler.restart(sync_follower.leaderMillis()
+                                  - scheduler.interval());
+        } else {
+                scheduler.slew(slew, now);
+        }
+}
+
+void printStats()
+{
+        console.print(F("shown="));
+        console.print(frames.shown());
+        console.print(F(" repeated="));
+        console.print(frames.repeated());
+        console.print(F(" dropped="));
+        console.print(frames.dropped());
+        console.print(F(" deadline_misses="));
+        console.print(governor.misses());
+        console.print(F(" quality="));
+        console.println(governor.level());
+
+        console.print(F("dmx packets="));
+        console.print(dmx.packets());
+        console.print(F(" bad="));
+        console.print(dmx.bad());
+        console.print(F(" unmapped="));
+        console.print(dmx.unmapped());
+        console.print(F(" latency_us="));
+        console.print(dmx.minLatency());
+        console.print(F(".."));
+        console.println(dmx.maxLatency());
+
+        console.print(F("opc messages="));
+        console.print(opc.messages());
+        console.print(F(" resyncs="));
+        console.print(opc.resyncs());
+        console.print(F(" skipped="));
+        console.print(opc.skipped());
+        console.print(F(" full_polls="));
+        console.print(opc.fullPolls());
+        console.print(F(" overruns="));
+        console.print(opc.overruns());
+        console.print(F(" max_backlog="));
+        console.println(opc.maxBacklog());
+
+        if (sync_role == SYNC_FOLLOWER) {
+                console.print(F("sync packets="));
+                console.print(sync_follower.packets());
+                console.print(F(" bad="));
+                console.print(sync_follower.bad());
+                console.print(F(" restarts="));
+                console.print(sync_follower.restarts());
+                console.print(F(" error_ms="));
+                console.print(sync_follower.lastError());
+                console.print(F(" max_error_ms="));
+                console.println(sync_follower.maxError());
+        }
+
+        console.print(F("console tx_dropped="));
+        console.print(console.txDropped());
+        console.print(F(" settings_saves="));
+        console.print(settings_log.saves());
+        console.print(F(" boot_dark_us="));
+        console.println(FastBoot::darkMicros());
+}
+
+void handleCommand(char *line)
+{
+        const ConsoleCommand c = ConsoleCommand::parse(line, {
+                nr_progs - 1,
+                LedProgram::maxFrequency() - 1,
+                LedProgram::maxBrightness() - 1,
+                TELEMETRY_STRIPS
+        });
+
+        switch (c.id) {
+        case ConsoleCommand::NONE:
+                break;
+        case ConsoleCommand::HELP:
+                console.println(F("get | prog|freq|brightness <n|auto>"));
+                console.println(F("stats | profile [reset] | ram | telemetry <0-2>"));
+                break;
+        case ConsoleCommand::GET:
+                console.print(F("prog="));
+                console.print(which_prog);
+                console.print(F(" freq="));
+                console.print(freq);
+                console.print(F(" brightness="));
+                console.println(brightness);
+                break;
+        case ConsoleCommand::PROG:
+                if (c.ok)
+                        prog_override = c.value;
+                else
+                        console.println(F("bad program"));
+                break;
+        case ConsoleCommand::FREQ:
+                if (c.ok)
+                        freq_override = c.value;
+                else
+                        console.println(F("bad frequency"));
+                break;
+        case ConsoleCommand::BRIGHTNESS:
+                if (c.ok)
+                        brightness_override = c.value;
+                else
+                        console.println(F("bad brightness"));
+                break;
+        case ConsoleCommand::STATS:
+                printStats();
+                break;
+        case ConsoleCommand::PROFILE:
+                StageProfiler::print(console);
+                break;
+        case ConsoleCommand::PROFILE_RESET:
+                StageProfiler::reset();
+                break;
+        case ConsoleCommand::RAM:
+                console.print(F("ram free="));
+                console.print(RamMonitor::freeNow());
+                console.print(F(" never_used="));
+                console.println(RamMonitor::neverUsed());
+                break;
+        case ConsoleCommand::TELEMETRY:
+                if (c.ok)
+                        telemetry = c.value;
+                else
+                        console.println(F("bad telemetry level"));
+                break;
+        case ConsoleCommand::UNKNOWN:
+                console.println(F("unknown command, try help"));
+                break;
+        }
+}
+
+// loop() does at most one strip worth of work per call so that it never
+// holds the CPU for a whole frame
+void loop()
+{
+        char *line = console.poll();
+        if (line)
+                handleCommand(line);
+
+        // live inputs (from a lighting desk, say) take priority over the
+        // programs, strip by strip. See LiveInput.h.
+        bool clobbered = false;
+        bool busy = false;
+        uint8_t live_strips = 0;
+        unsigned long now = millis();
+
+        saveSettings(now);
+
+        if (sync_role == SYNC_FOLLOWER)
+                followLeader(now);
+        {
+                ProfileStage stage{StageProfiler::LIVE_INPUT};
+                for (uint8_t i = 0; i < nr_live_inputs; ++i) {
+                        clobbered |= live_inputs[i]->poll(strip, *output);
+                        busy |= live_inputs[i]->busy(now);
+                        live_strips |= live_inputs[i]->ownedStrips(now);
+                }
+        }
+
+        // the program's frame in progress carries on: every strip is
+        // rendered from scratch, except for programs that re-use strip 0,
+        // which get it rendered again. Giving up on the frame instead would
+        // let a fast stream on one strip starve the strips after it.
+        if (clobbered) {
+                frames.invalidate();
+                first_strip_lost = true;
+        }
+
+        // nobody else may touch the strip buffer while a live input has
+        // something half written into it, and if the live inputs have all
+        // the strips there's nothing for the programs to do.
+        if (busy || live_strips == (1 << nr_strips) - 1)
+                return;
+
+        if (scheduler.idle()) {
+                if (!scheduler.due(now))
+                        return;
+                startFrame();
+        }
+
+        showStrip(scheduler.nextStrip(), live_strips);
+
+        if (scheduler.idle())
+                finishFrame();
 }
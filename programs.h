@@ -0,0 +1,54 @@
+// programs.h
+//
+// The LED programs, in the order the knob steps through them. Add new
+// programs here. They're in a header of their own, rather than in the
+// sketch, so that test/golden_test.cpp renders exactly the programs the board
+// does when it makes golden_hashes.h.
+
+#pragma once
+
+#include "Canvas.h"
+#include "CompositeProg.h"
+#include "LedProgram.h"
+#include "NoiseProgs.h"
+#include "StripState.h"
+#include "Wave.h"
+#include "layout.h"
+
+BlinkerProg blinker;
+RgbBlinkerProg rgb_blinker;
+SingleColorProg single_color;
+ColorTempProg color_temp;
+SparkleProg sparkle;
+RadarProg<TableGeometry> radar;
+CometProg comet{TableLayout::nr_strips};
+BreatheProg<TableLayout::nr_strips> breathe;
+WaterProg water{TableLayout::nr_strips};
+CandleProg candle;
+CloudsProg<TableGeometry> clouds;
+RainbowWaveProg rainbow_wave;
+PlasmaProg plasma;
+SwellProg swell;
+CompositeProg sparkle_over_temp{color_temp, sparkle, CompositeProg::SCREEN,
+                                TableLayout::leds_per_strip,
+                                TableLayout::color_order};
+
+LedProgram *progs[] = {
+        &blinker,
+        &rgb_blinker,
+        &single_color,
+        &color_temp,
+        &sparkle,
+        &sparkle_over_temp,
+        &radar,
+        &comet,
+        &breathe,
+        &water,
+        &candle,
+        &clouds,
+        &rainbow_wave,
+        &plasma,
+        &swell
+};
+
+const uint8_t nr_progs = (sizeof progs)/(sizeof progs[0]);
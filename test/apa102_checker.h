@@ -0,0 +1,79 @@
+// apa102_checker.h
+//
+// Checks a byte stream against the APA102 protocol, the way a strip would
+// take it: a start frame, a header byte and three color bytes per LED, and
+// enough of an end frame to clock the data through. apa102Frame() is what
+// Adafruit_DotStar::show() should send for a strip, byte for byte.
+
+#pragma once
+
+#include <Adafruit_DotStar.h>
+#include <Arduino.h>
+
+#include <vector>
+
+class Apa102Checker
+{
+private:
+        uint16_t nr_leds_;
+        uint8_t start_bytes_ = 0;
+        uint16_t leds_ = 0;
+        uint8_t led_byte_ = 0;
+        uint16_t end_bytes_ = 0;
+        bool ok_ = true;
+
+public:
+        Apa102Checker(const uint16_t nr_leds) : nr_leds_{nr_leds} {}
+
+        void add(const uint8_t b)
+        {
+                // 32 zero bits of start frame
+                if (start_bytes_ < 4) {
+                        if (b != 0)
+                                ok_ = false;
+                        ++start_bytes_;
+                        return;
+                }
+
+                // per LED: 0b111 plus 5 bits of global brightness, then 3
+                // color bytes
+                if (leds_ < nr_leds_) {
+                        if (led_byte_ == 0 && (b & 0xe0) != 0xe0)
+                                ok_ = false;
+                        if (++led_byte_ == 4) {
+                                led_byte_ = 0;
+                                ++leds_;
+                        }
+                        return;
+                }
+
+                // the end frame has to be at least half a clock per LED of
+                // ones, to push the data through the whole strip
+                if (b != 0xff)
+                        ok_ = false;
+                ++end_bytes_;
+        }
+
+        bool ok() const
+        {
+                return ok_ && start_bytes_ == 4 && leds_ == nr_leds_
+                        && 16*end_bytes_ >= nr_leds_;
+        }
+};
+
+// a start frame, a header and three brightness scaled bytes per LED, in the
+// strip's color order, and the end frame
+inline std::vector<uint8_t> apa102Frame(Adafruit_DotStar& strip,
+                                        const uint8_t brightness)
+{
+        std::vector<uint8_t> bytes(4, 0);
+        for (uint16_t i = 0; i < 3*strip.numPixels(); ++i) {
+                if (i % 3 == 0)
+                        bytes.push_back(0xff);
+                const uint8_t p = strip.getPixels()[i];
+                bytes.push_back(brightness == 255 ? p : (p*(brightness + 1)) >> 8);
+        }
+        for (uint16_t i = 0; i < (strip.numPixels() + 15)/16; ++i)
+                bytes.push_back(0xff);
+        return bytes;
+}
@@ -0,0 +1,153 @@
+// Adafruit_DotStar.h
+//
+// The parts of Adafruit's DotStar class the board's headers use, for the
+// tests in this directory. Pixels are kept in the strip's color order like
+// the real thing, and show() bit-bangs them out on the fake ports the way
+// the real one's software SPI does, so a test watching the pins (see
+// vcd_trace.h) sees the same edges the strip would.
+
+#pragma once
+
+#include <Arduino.h>
+
+// which byte of a pixel red, green and blue go in, as in the real library
+#define DOTSTAR_RGB (0 | (1 << 2) | (2 << 4))
+#define DOTSTAR_BGR (2 | (1 << 2) | (0 << 4))
+
+class Adafruit_DotStar
+{
+private:
+        uint16_t n_;
+        uint8_t *pixels_;
+        uint8_t brightness_ = 0;
+        uint8_t r_offset_, g_offset_, b_offset_;
+        uint8_t first_data_pin_, first_clk_pin_;
+
+        // like sw_spi_out(): set the data pin, then pulse the clock, a bit at
+        // a time
+        void spiOut(uint8_t b)
+        {
+                for (uint8_t i = 0; i < 8; ++i, b <<= 1) {
+                        digitalWrite(data_pin, b & 0x80 ? HIGH : LOW);
+                        digitalWrite(clk_pin, HIGH);
+                        digitalWrite(clk_pin, LOW);
+                }
+        }
+
+public:
+        uint8_t data_pin = 0;
+        uint8_t clk_pin = 0;
+        unsigned shows = 0;
+
+        Adafruit_DotStar(const uint16_t n, const uint8_t data, const uint8_t clk,
+                         const uint8_t order = DOTSTAR_BGR)
+                : n_{n}, pixels_{new uint8_t[3*n]()},
+                  r_offset_(order & 3), g_offset_((order >> 2) & 3),
+                  b_offset_((order >> 4) & 3), first_data_pin_{data},
+                  first_clk_pin_{clk}, data_pin{data}, clk_pin{clk}
+        {}
+
+        // the real one's hardware SPI constructor, which is also what gets
+        // used for buffers that are never shown
+        Adafruit_DotStar(const uint16_t n, const uint8_t order)
+                : Adafruit_DotStar{n, 0, 0, order}
+        {}
+
+        Adafruit_DotStar(const Adafruit_DotStar&) = delete;
+        Adafruit_DotStar& operator=(const Adafruit_DotStar&) = delete;
+
+        ~Adafruit_DotStar()
+        {
+                delete[] pixels_;
+        }
+
+        void begin() {}
+
+        void show()
+        {
+                ++shows;
+
+                for (uint8_t i = 0; i < 4; ++i)
+                        spiOut(0);
+
+                // the real one keeps brightness + 1, and 0 means don't scale
+                const uint8_t scale = brightness_ + 1;
+                for (uint16_t i = 0; i < 3*n_; ++i) {
+                        if (i % 3 == 0)
+                                spiOut(0xff);
+                        spiOut(scale ? (pixels_[i]*(uint16_t)scale) >> 8
+                               : pixels_[i]);
+                }
+
+                for (uint16_t i = 0; i < (n_ + 15)/16; ++i)
+                        spiOut(0xff);
+        }
+
+        void clear()
+        {
+                memset(pixels_, 0, 3*n_);
+        }
+
+        // the real one switches to hardware SPI. Here it goes back to the
+        // pins the strip was made with, which in the sketch are strip 0's.
+        void updatePins()
+        {
+                data_pin = first_data_pin_;
+                clk_pin = first_clk_pin_;
+        }
+
+        void updatePins(const uint8_t data, const uint8_t clk)
+        {
+                data_pin = data;
+                clk_pin = clk;
+        }
+
+        void setPixelColor(const uint16_t i, const uint8_t r, const uint8_t g,
+                           const uint8_t b)
+        {
+                if (i >= n_)
+                        return;
+                uint8_t *p = pixels_ + 3*i;
+                p[r_offset_] = r;
+                p[g_offset_] = g;
+                p[b_offset_] = b;
+        }
+
+        void setPixelColor(const uint16_t i, const uint32_t c)
+        {
+                setPixelColor(i, c >> 16, c >> 8, c);
+        }
+
+        uint32_t getPixelColor(const uint16_t i) const
+        {
+                if (i >= n_)
+                        return 0;
+                const uint8_t *p = pixels_ + 3*i;
+                return Color(p[r_offset_], p[g_offset_], p[b_offset_]);
+        }
+
+        static uint32_t Color(const uint8_t r, const uint8_t g, const uint8_t b)
+        {
+                return (uint32_t)r << 16 | (uint32_t)g << 8 | b;
+        }
+
+        void setBrightness(const uint8_t b)
+        {
+                brightness_ = b;
+        }
+
+        uint8_t getBrightness() const
+        {
+                return brightness_;
+        }
+
+        uint16_t numPixels() const
+        {
+                return n_;
+        }
+
+        uint8_t *getPixels() const
+        {
+                return pixels_;
+        }
+};
@@ -0,0 +1,372 @@
+// Arduino.h
+//
+// Just enough of the Arduino core to run the board's headers on a computer,
+// for the tests in this directory. Flash is ordinary memory, time only moves
+// when a test says so, and random() is avr-libc's, so that anything seeded
+// the same way gets the same numbers as on the board. Ports are bytes that
+// tests can watch change.
+
+#pragma once
+
+#include <math.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+typedef uint8_t byte;
+
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+
+// flash strings are just strings, but keep their own type so that anything
+// that takes one still has to say so
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+template <class P>
+P pgm_read_byte(const P *p)
+{
+        return *p;
+}
+
+template <class P>
+P pgm_read_word(const P *p)
+{
+        return *p;
+}
+
+template <class P>
+P pgm_read_dword(const P *p)
+{
+        return *p;
+}
+
+inline void *memcpy_P(void *dest, const void *src, size_t n)
+{
+        return memcpy(dest, src, n);
+}
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+
+// I/O ports. Pin p is bit p % 8 of port p / 8, which isn't the Mega's
+// mapping but has the same shape. Writing a mask to a port's PINx register
+// toggles those bits of PORTx, like on the AVR, and every change to a port
+// is passed to portWatcher(), if there is one, so a test can follow the pin
+// levels edge by edge.
+//
+// Port A, which ScopeMarker writes by name, is a port of its own after the
+// pins' ports, so it doesn't clash with any pin.
+const uint8_t NR_FAKE_PORTS = 13;
+const uint8_t FAKE_PORT_A = 12;
+
+inline uint8_t *fakePorts()
+{
+        static uint8_t ports[NR_FAKE_PORTS];
+        return ports;
+}
+
+typedef void (*PortWatcher)(uint8_t port);
+
+inline PortWatcher& portWatcher()
+{
+        static PortWatcher w = NULL;
+        return w;
+}
+
+inline void portChanged(const uint8_t port)
+{
+        if (portWatcher())
+                portWatcher()(port);
+}
+
+class TogglePort
+{
+public:
+        uint8_t port;
+
+        void operator=(const uint8_t mask)
+        {
+                fakePorts()[port] ^= mask;
+                portChanged(port);
+        }
+};
+
+// a PORTx register, written by name
+class PortRegister
+{
+public:
+        uint8_t port;
+
+        void operator|=(const uint8_t mask)
+        {
+                fakePorts()[port] |= mask;
+                portChanged(port);
+        }
+
+        void operator&=(const uint8_t mask)
+        {
+                fakePorts()[port] &= mask;
+                portChanged(port);
+        }
+
+        operator uint8_t() const
+        {
+                return fakePorts()[port];
+        }
+};
+
+#define PORTA (PortRegister{FAKE_PORT_A})
+static volatile uint8_t DDRA;
+
+inline uint8_t digitalPinToPort(const uint8_t pin)
+{
+        return pin / 8;
+}
+
+inline uint8_t digitalPinToBitMask(const uint8_t pin)
+{
+        return 1 << pin % 8;
+}
+
+inline TogglePort *portInputRegister(const uint8_t port)
+{
+        static TogglePort regs[NR_FAKE_PORTS];
+        regs[port].port = port;
+        return &regs[port];
+}
+
+inline volatile uint8_t *portOutputRegister(const uint8_t port)
+{
+        return fakePorts() + port;
+}
+
+inline void pinMode(const uint8_t pin, const uint8_t mode)
+{
+        (void)pin;
+        (void)mode;
+}
+
+inline void digitalWrite(const uint8_t pin, const uint8_t value)
+{
+        const uint8_t port = digitalPinToPort(pin);
+        if (value)
+                fakePorts()[port] |= digitalPinToBitMask(pin);
+        else
+                fakePorts()[port] &= ~digitalPinToBitMask(pin);
+        portChanged(port);
+}
+
+// the clock, which tests move by hand
+inline unsigned long& fakeMicros()
+{
+        static unsigned long now = 0;
+        return now;
+}
+
+inline unsigned long micros()
+{
+        return fakeMicros();
+}
+
+// added to millis(), so a test can start it just short of wrapping around
+inline unsigned long& fakeMillisOffset()
+{
+        static unsigned long offset = 0;
+        return offset;
+}
+
+inline unsigned long millis()
+{
+        return fakeMicros()/1000 + fakeMillisOffset();
+}
+
+// nothing here interrupts, so there's nothing to turn off, and ISRs are
+// plain functions that only run if a test calls them
+inline void noInterrupts() {}
+inline void interrupts() {}
+#define ISR(vector) void vector()
+
+#define _BV(bit) (1 << (bit))
+
+// timer 3, which StageProfiler sets up. It never ticks by itself; see
+// profiler_test.cpp for a test ticking it.
+static volatile uint8_t TCCR3A, TCCR3B, TIMSK3;
+static volatile uint16_t TCNT3, OCR3A;
+#define WGM32 3
+#define CS31 1
+#define CS30 0
+#define OCIE3A 1
+
+// avr-libc's random(): Park and Miller's minimal standard generator, in 32
+// bit longs
+inline uint32_t& randomState()
+{
+        static uint32_t state = 1;
+        return state;
+}
+
+inline long random()
+{
+        int32_t x = randomState();
+        if (x == 0)
+                x = 123459876L;
+        const int32_t hi = x / 127773L;
+        const int32_t lo = x % 127773L;
+        x = 16807L * lo - 2836L * hi;
+        if (x < 0)
+                x += 0x7fffffffL;
+        randomState() = x;
+        return x % 0x80000000UL;
+}
+
+inline long random(const long howbig)
+{
+        return howbig == 0 ? 0 : random() % howbig;
+}
+
+inline long random(const long howsmall, const long howbig)
+{
+        return howsmall >= howbig ? howsmall : random(howbig - howsmall) + howsmall;
+}
+
+inline void randomSeed(const unsigned long seed)
+{
+        if (seed != 0)
+                randomState() = seed;
+}
+
+// output goes into a string for the test to look at
+class Print
+{
+public:
+        std::string out;
+
+        virtual ~Print() {}
+
+        virtual size_t write(const uint8_t c)
+        {
+                out += (char)c;
+                return 1;
+        }
+
+        size_t write(const uint8_t *buf, size_t n)
+        {
+                for (size_t i = 0; i < n; ++i)
+                        write(buf[i]);
+                return n;
+        }
+
+        size_t print(const char *s)
+        {
+                return write((const uint8_t *)s, strlen(s));
+        }
+
+        size_t print(const __FlashStringHelper *s)
+        {
+                return print(reinterpret_cast<const char *>(s));
+        }
+
+        size_t print(const char c)
+        {
+                return write((uint8_t)c);
+        }
+
+        size_t print(const unsigned long n, const int base = DEC)
+        {
+                char buf[24];
+                snprintf(buf, sizeof buf, base == HEX ? "%lX" : "%lu", n);
+                return print(buf);
+        }
+
+        size_t print(const long n, const int base = DEC)
+        {
+                if (base != DEC)
+                        return print((unsigned long)n, base);
+                char buf[24];
+                snprintf(buf, sizeof buf, "%ld", n);
+                return print(buf);
+        }
+
+        size_t print(const unsigned n, const int base = DEC)
+        {
+                return print((unsigned long)n, base);
+        }
+
+        size_t print(const int n, const int base = DEC)
+        {
+                return print((long)n, base);
+        }
+
+        size_t print(const unsigned char n, const int base = DEC)
+        {
+                return print((unsigned long)n, base);
+        }
+
+        size_t println()
+        {
+                return print("\r\n");
+        }
+
+        template <class X>
+        size_t println(const X& x)
+        {
+                return print(x) + println();
+        }
+
+        template <class X>
+        size_t println(const X& x, const int base)
+        {
+                return print(x, base) + println();
+        }
+};
+
+// input comes from a string the test fills in
+class Stream : public Print
+{
+public:
+        std::string in;
+        size_t in_pos = 0;
+
+        void feed(const uint8_t *buf, size_t n)
+        {
+                in.append((const char *)buf, n);
+        }
+
+        int available()
+        {
+                return in.size() - in_pos;
+        }
+
+        int read()
+        {
+                return in_pos < in.size() ? (uint8_t)in[in_pos++] : -1;
+        }
+
+        int peek()
+        {
+                return in_pos < in.size() ? (uint8_t)in[in_pos] : -1;
+        }
+
+        size_t readBytes(uint8_t *buf, size_t n)
+        {
+                size_t i = 0;
+                for (; i < n && in_pos < in.size(); ++i)
+                        buf[i] = in[in_pos++];
+                return i;
+        }
+
+        // like the real core's, a test can make the port slow
+        virtual int availableForWrite()
+        {
+                return 64;
+        }
+};
@@ -0,0 +1,259 @@
+// avr_int.h
+//
+// Integers that do arithmetic the way avr-gcc does, for running the board's
+// integer code on a computer.
+//
+// On the AVR int is 16 bits and long is 32, so an expression like
+// (int32_t)(b - a) on two int16_ts wraps at 16 bits before it's ever cast,
+// where on a computer the same code quietly gets the right answer. To catch
+// that, a test #defines uint8_t, int16_t, uint16_t, int32_t and uint32_t to
+// the types here before including the header under test (which must only
+// need <Arduino.h>, included first). Every operation then promotes and
+// converts like the AVR: uint8_t and int16_t go to a 16 bit int, uint16_t to
+// a 16 bit unsigned, and so on. Signed overflow, which is undefined and
+// which avr-gcc usually turns into a wrong answer, wraps like on the board
+// and is counted in avr::overflows().
+//
+// Multiplies are also counted, by the width they're done in, in
+// avr::multiplies(), as a measure of what code costs on the board: see
+// there.
+//
+// Only what our headers use is here: + - * / % & | ^ << >>, comparisons,
+// unary minus, compound assignment, and pointer + index. A decimal literal
+// is an int if it fits in 16 bits and a long otherwise, like on the AVR.
+
+#pragma once
+
+#include <stdint.h>
+
+namespace avr {
+
+enum Kind : uint8_t {
+        U8,
+        INT,
+        UINT,
+        LONG,
+        ULONG
+};
+
+inline unsigned long& overflows()
+{
+        static unsigned long n = 0;
+        return n;
+}
+
+inline uint8_t bits(const Kind k)
+{
+        return k == LONG || k == ULONG ? 32 : 16;
+}
+
+// multiplies done so far. The AVR has an 8x8 bit hardware multiply (MUL, 2
+// cycles), so a 16 bit multiply is a few MULs and adds inline, but a 32 bit
+// one is a call to libgcc's __mulsi3 that does ten of them, several times
+// the cost. These count every * as written; avr-gcc makes some, e.g. by a
+// power of two, into shifts instead, so they're an upper bound.
+struct Multiplies
+{
+        unsigned long m16;
+        unsigned long m32;
+};
+
+inline Multiplies& multiplies()
+{
+        static Multiplies n = {0, 0};
+        return n;
+}
+
+// v as a value of kind k, wrapping like a conversion does
+constexpr int64_t wrap(const int64_t v, const Kind k)
+{
+        return k == U8 ? (int64_t)(uint8_t)v
+                : k == INT ? (int64_t)(int16_t)v
+                : k == UINT ? (int64_t)(uint16_t)v
+                : k == LONG ? (int64_t)(int32_t)v
+                : (int64_t)(uint32_t)v;
+}
+
+constexpr bool isSigned(const Kind k)
+{
+        return k == INT || k == LONG;
+}
+
+constexpr Kind promote(const Kind k)
+{
+        return k == U8 ? INT : k;
+}
+
+// the usual arithmetic conversions, with a 16 bit int and a 32 bit long
+constexpr Kind common(const Kind a, const Kind b)
+{
+        return promote(a) == ULONG || promote(b) == ULONG ? ULONG
+                : promote(a) == LONG || promote(b) == LONG ? LONG
+                : promote(a) == UINT || promote(b) == UINT ? UINT
+                : INT;
+}
+
+struct Num
+{
+        int64_t v;
+        Kind k;
+
+        constexpr Num() : v{0}, k{INT} {}
+        constexpr Num(const int64_t value, const Kind kind) : v{value}, k{kind} {}
+
+        constexpr Num(const int x)
+                : v{x}, k{x >= -32768 && x <= 32767 ? INT : LONG} {}
+        constexpr Num(const unsigned x) : v{x}, k{x <= 0xffff ? UINT : ULONG} {}
+        constexpr Num(const long x) : v{x}, k{LONG} {}
+        constexpr Num(const unsigned long x) : v{(int64_t)x}, k{ULONG} {}
+
+        explicit operator bool() const
+        {
+                return v != 0;
+        }
+};
+
+// the result of an operation: exact is the mathematically right answer
+inline const Num result(const int64_t exact, const Kind k)
+{
+        const int64_t v = wrap(exact, k);
+        if (isSigned(k) && v != exact)
+                ++overflows();
+        return Num{v, k};
+}
+
+template <Kind K>
+struct T : Num
+{
+        constexpr T() : Num{0, K} {}
+        constexpr T(const Num& n) : Num{wrap(n.v, K), K} {}
+        constexpr T(const int x) : Num{wrap(x, K), K} {}
+        constexpr T(const unsigned x) : Num{wrap(x, K), K} {}
+        constexpr T(const long x) : Num{wrap(x, K), K} {}
+        constexpr T(const unsigned long x) : Num{wrap((int64_t)x, K), K} {}
+
+        T& operator+=(const Num& n);
+        T& operator-=(const Num& n);
+        T& operator*=(const Num& n);
+        T& operator>>=(const Num& n);
+        T& operator<<=(const Num& n);
+        T& operator|=(const Num& n);
+        T& operator&=(const Num& n);
+        T& operator++() { return *this += 1; }
+        T& operator--() { return *this -= 1; }
+};
+
+#define AVR_INT_ARITH(op)                                                       \
+        inline const Num operator op(const Num& a, const Num& b)               \
+        {                                                                       \
+                const Kind k = common(a.k, b.k);                                \
+                return result(wrap(a.v, k) op wrap(b.v, k), k);                 \
+        }
+
+AVR_INT_ARITH(+)
+AVR_INT_ARITH(-)
+AVR_INT_ARITH(&)
+AVR_INT_ARITH(|)
+AVR_INT_ARITH(^)
+
+#undef AVR_INT_ARITH
+
+inline const Num operator*(const Num& a, const Num& b)
+{
+        const Kind k = common(a.k, b.k);
+        if (bits(k) == 32)
+                ++multiplies().m32;
+        else
+                ++multiplies().m16;
+        // an unsigned long product can overflow int64_t, but we only want
+        // it mod 2^32 anyway
+        if (k == ULONG)
+                return result((int64_t)((uint64_t)wrap(a.v, k) * (uint64_t)wrap(b.v, k)), k);
+        return result(wrap(a.v, k) * wrap(b.v, k), k);
+}
+
+inline const Num operator/(const Num& a, const Num& b)
+{
+        const Kind k = common(a.k, b.k);
+        if (wrap(b.v, k) == 0) {
+                ++overflows();
+                return Num{0, k};
+        }
+        return result(wrap(a.v, k) / wrap(b.v, k), k);
+}
+
+inline const Num operator%(const Num& a, const Num& b)
+{
+        const Kind k = common(a.k, b.k);
+        if (wrap(b.v, k) == 0) {
+                ++overflows();
+                return Num{0, k};
+        }
+        return result(wrap(a.v, k) % wrap(b.v, k), k);
+}
+
+inline const Num operator<<(const Num& a, const Num& n)
+{
+        const Kind k = promote(a.k);
+        if (n.v < 0 || n.v >= bits(k)) {
+                ++overflows();
+                return Num{0, k};
+        }
+        return result(a.v * ((int64_t)1 << n.v), k);
+}
+
+inline const Num operator>>(const Num& a, const Num& n)
+{
+        const Kind k = promote(a.k);
+        if (n.v < 0 || n.v >= bits(k)) {
+                ++overflows();
+                return Num{0, k};
+        }
+        // arithmetic for signed, like avr-gcc
+        return Num{a.v >> n.v, k};
+}
+
+inline const Num operator-(const Num& a)
+{
+        const Kind k = promote(a.k);
+        return result(-a.v, k);
+}
+
+inline const Num operator~(const Num& a)
+{
+        const Kind k = promote(a.k);
+        return Num{wrap(~a.v, k), k};
+}
+
+#define AVR_INT_COMPARE(op)                                                     \
+        inline bool operator op(const Num& a, const Num& b)                     \
+        {                                                                       \
+                const Kind k = common(a.k, b.k);                                \
+                return wrap(a.v, k) op wrap(b.v, k);                            \
+        }
+
+AVR_INT_COMPARE(==)
+AVR_INT_COMPARE(!=)
+AVR_INT_COMPARE(<)
+AVR_INT_COMPARE(<=)
+AVR_INT_COMPARE(>)
+AVR_INT_COMPARE(>=)
+
+#undef AVR_INT_COMPARE
+
+template <Kind K> T<K>& T<K>::operator+=(const Num& n) { return *this = *this + n; }
+template <Kind K> T<K>& T<K>::operator-=(const Num& n) { return *this = *this - n; }
+template <Kind K> T<K>& T<K>::operator*=(const Num& n) { return *this = *this * n; }
+template <Kind K> T<K>& T<K>::operator>>=(const Num& n) { return *this = *this >> n; }
+template <Kind K> T<K>& T<K>::operator<<=(const Num& n) { return *this = *this << n; }
+template <Kind K> T<K>& T<K>::operator|=(const Num& n) { return *this = *this | n; }
+template <Kind K> T<K>& T<K>::operator&=(const Num& n) { return *this = *this & n; }
+
+// indexing a table, e.g. PERM + i
+template <Kind K>
+const T<K> *operator+(const T<K> *p, const Num& i)
+{
+        return p + i.v;
+}
+
+}
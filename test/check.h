@@ -0,0 +1,36 @@
+// check.h
+//
+// The smallest test harness that works: CHECK() prints where and what
+// failed and keeps going, and main() returns checkResult() so make stops on
+// a failing test.
+
+#pragma once
+
+#include <stdio.h>
+
+inline unsigned& checkFailures()
+{
+        static unsigned n = 0;
+        return n;
+}
+
+#define CHECK(cond, ...)                                                        \
+        do {                                                                    \
+                if (!(cond)) {                                                  \
+                        ++checkFailures();                                      \
+                        printf("%s:%d: CHECK(%s) failed: ", __FILE__, __LINE__, \
+                               #cond);                                          \
+                        printf(__VA_ARGS__);                                    \
+                        printf("\n");                                           \
+                }                                                               \
+        } while (0)
+
+inline int checkResult(const char *name)
+{
+        if (checkFailures() == 0) {
+                printf("%s: ok\n", name);
+                return 0;
+        }
+        printf("%s: %u failed\n", name, checkFailures());
+        return 1;
+}
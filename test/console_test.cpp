@@ -0,0 +1,179 @@
+// console_test.cpp
+//
+// Console.h against a fake serial port: lines split on CR, LF or both, blank
+// lines and lines too long for the 48 byte buffer skipped, no more than 16
+// bytes read per poll(), and replies dropped (and counted) rather than waited
+// for when the port is slow. Then every command ConsoleCommand.h knows, with
+// good and bad arguments.
+
+#include <Arduino.h>
+
+#include "../Console.h"
+#include "../ConsoleCommand.h"
+
+#include "check.h"
+
+#include <string>
+
+namespace {
+
+// a serial port that only takes "room" bytes at a time
+class SlowSerial : public Stream
+{
+public:
+        int room = 64;
+
+        int availableForWrite() override
+        {
+                return room;
+        }
+};
+
+void feed(Stream& s, const std::string& text)
+{
+        s.feed((const uint8_t *)text.data(), text.size());
+}
+
+// poll until a line comes out, or the input runs out
+std::string nextLine(Console& console, Stream& s)
+{
+        for (;;) {
+                const char *line = console.poll();
+                if (line)
+                        return line;
+                if (!s.available())
+                        return "(none)";
+        }
+}
+
+const ConsoleCommand::Limits LIMITS = {11, 1023, 1023, 2};
+
+ConsoleCommand parse(const char *text)
+{
+        char line[48];
+        strncpy(line, text, sizeof line);
+        line[sizeof line - 1] = '\0';
+        return ConsoleCommand::parse(line, LIMITS);
+}
+
+// commands without an argument leave it AUTO
+void checkCommand(const char *text, const ConsoleCommand::Id id,
+                  const bool ok = true,
+                  const int16_t value = ConsoleCommand::AUTO)
+{
+        const ConsoleCommand c = parse(text);
+        CHECK(c.id == id, "\"%s\" parsed as command %u, want %u", text, c.id, id);
+        CHECK(c.ok == ok, "\"%s\" %s", text, ok ? "rejected" : "accepted");
+        if (ok && c.ok)
+                CHECK(c.value == value, "\"%s\" gave %d, want %d", text, c.value,
+                      value);
+}
+
+}
+
+int main()
+{
+        SlowSerial serial;
+        Console console{serial};
+
+        // every line ending, and blank lines in between
+        feed(serial, "help\r\nget\n\n\r\r\nstats\rram\r\n");
+        const char *const want[] = {"help", "get", "stats", "ram"};
+        for (const char *w : want) {
+                const std::string got = nextLine(console, serial);
+                CHECK(got == w, "got line \"%s\", want \"%s\"", got.c_str(), w);
+        }
+        CHECK(nextLine(console, serial) == "(none)", "a blank line came out");
+
+        // 47 characters fit, with the '\0'; 48 don't, and the whole line
+        // goes, not just the end of it
+        const std::string fits(47, 'a');
+        feed(serial, fits + "\n");
+        CHECK(nextLine(console, serial) == fits, "a 47 character line didn't fit");
+
+        feed(serial, std::string(48, 'b') + "\nget\n");
+        CHECK(nextLine(console, serial) == "get", "a 48 character line came out");
+        console.poll();
+        CHECK(serial.out.find("line too long") != std::string::npos,
+              "no complaint about a long line");
+
+        feed(serial, std::string(300, 'c') + "\r\nram\r\n");
+        CHECK(nextLine(console, serial) == "ram",
+              "the line after a 300 character one got lost");
+
+        // no more than 16 bytes per poll, whatever's waiting
+        feed(serial, std::string(100, 'd'));
+        const size_t before = serial.available();
+        console.poll();
+        CHECK(before - serial.available() == 16, "read %zu bytes in one poll",
+              before - serial.available());
+        feed(serial, "\n");
+        while (serial.available())
+                console.poll();
+
+        // a port with no room: replies wait in the ring, then get dropped
+        // once it's full, and nothing blocks. The ring takes 255, one slot
+        // is kept empty.
+        console.poll();
+        serial.out.clear();
+        serial.room = 0;
+        for (int i = 0; i < 300; ++i)
+                console.write('x');
+        console.poll();
+        CHECK(serial.out.empty(), "wrote %zu bytes with no room", serial.out.size());
+        CHECK(console.txDropped() == 300 - 255, "dropped %u bytes, want %u",
+              (unsigned)console.txDropped(), 300 - 255);
+
+        // then drains as fast as the port takes it
+        serial.room = 10;
+        console.poll();
+        CHECK(serial.out.size() == 10, "wrote %zu bytes with room for 10",
+              serial.out.size());
+        serial.room = 64;
+        for (int i = 0; i < 10; ++i)
+                console.poll();
+        CHECK(serial.out == std::string(255, 'x'), "wrote %zu bytes, want 255",
+              serial.out.size());
+
+        // the commands
+        checkCommand("", ConsoleCommand::NONE);
+        checkCommand("   ", ConsoleCommand::NONE);
+        checkCommand("help", ConsoleCommand::HELP);
+        checkCommand("get", ConsoleCommand::GET);
+        checkCommand("stats", ConsoleCommand::STATS);
+        checkCommand("ram", ConsoleCommand::RAM);
+        checkCommand("profile", ConsoleCommand::PROFILE);
+        checkCommand("profile reset", ConsoleCommand::PROFILE_RESET);
+        checkCommand("profile junk", ConsoleCommand::PROFILE);
+        checkCommand("bogus", ConsoleCommand::UNKNOWN);
+        checkCommand("Help", ConsoleCommand::UNKNOWN);
+
+        checkCommand("prog 3", ConsoleCommand::PROG, true, 3);
+        checkCommand("  prog   11  ", ConsoleCommand::PROG, true, 11);
+        checkCommand("prog 12", ConsoleCommand::PROG, false, 0);
+        checkCommand("prog -1", ConsoleCommand::PROG, false, 0);
+        checkCommand("prog 3x", ConsoleCommand::PROG, false, 0);
+        checkCommand("prog", ConsoleCommand::PROG, false, 0);
+        checkCommand("prog auto", ConsoleCommand::PROG, true, ConsoleCommand::AUTO);
+        checkCommand("prog pot", ConsoleCommand::PROG, true, ConsoleCommand::AUTO);
+
+        checkCommand("freq 0", ConsoleCommand::FREQ, true, 0);
+        checkCommand("freq 1023", ConsoleCommand::FREQ, true, 1023);
+        checkCommand("freq 1024", ConsoleCommand::FREQ, false, 0);
+        checkCommand("freq 99999999999", ConsoleCommand::FREQ, false, 0);
+        checkCommand("freq auto", ConsoleCommand::FREQ, true, ConsoleCommand::AUTO);
+
+        checkCommand("brightness 512", ConsoleCommand::BRIGHTNESS, true, 512);
+        checkCommand("brightness 1024", ConsoleCommand::BRIGHTNESS, false, 0);
+        checkCommand("brightness", ConsoleCommand::BRIGHTNESS, false, 0);
+        checkCommand("brightness pot", ConsoleCommand::BRIGHTNESS, true,
+                     ConsoleCommand::AUTO);
+
+        checkCommand("telemetry 0", ConsoleCommand::TELEMETRY, true, 0);
+        checkCommand("telemetry 2", ConsoleCommand::TELEMETRY, true, 2);
+        checkCommand("telemetry 3", ConsoleCommand::TELEMETRY, false, 0);
+        checkCommand("telemetry auto", ConsoleCommand::TELEMETRY, false, 0);
+        checkCommand("telemetry", ConsoleCommand::TELEMETRY, false, 0);
+
+        return checkResult("console_test");
+}
@@ -0,0 +1,246 @@
+// dmx_test.cpp
+//
+// DmxReceiver.h fed SLIP framed E1.31 and Art-Net packets: the pixels land
+// on the mapped strip, a strip split between two universes keeps both
+// halves, the same universe number means the same pixels over either
+// protocol, and packets for universes or strips we haven't got are dropped.
+
+#include <Arduino.h>
+
+#include "../DmxReceiver.h"
+
+#include "check.h"
+
+#include <vector>
+
+namespace {
+
+const uint8_t NR_STRIPS = 4;
+const uint16_t NR_PIXELS = 144;
+
+// what each strip was last shown as
+class CaptureOutput : public LedOutput
+{
+public:
+        std::vector<uint32_t> shown[NR_STRIPS];
+        unsigned nr_shows = 0;
+
+        void show(Adafruit_DotStar& strip, const uint8_t strip_nr)
+        {
+                ++nr_shows;
+                CHECK(strip_nr < NR_STRIPS, "showed strip %u", strip_nr);
+                if (strip_nr >= NR_STRIPS)
+                        return;
+
+                shown[strip_nr].clear();
+                for (uint16_t i = 0; i < strip.numPixels(); ++i)
+                        shown[strip_nr].push_back(strip.getPixelColor(i));
+        }
+};
+
+// a recognizable color for pixel i of a universe
+uint32_t color(const uint16_t universe, const uint16_t i)
+{
+        return Adafruit_DotStar::Color(universe, i >> 8, i);
+}
+
+std::vector<uint8_t> slots(const uint16_t universe, const uint16_t nr_pixels)
+{
+        std::vector<uint8_t> s;
+        for (uint16_t i = 0; i < nr_pixels; ++i) {
+                const uint32_t c = color(universe, i);
+                s.push_back(c >> 16);
+                s.push_back(c >> 8);
+                s.push_back(c);
+        }
+        return s;
+}
+
+void put16(std::vector<uint8_t>& p, const size_t at, const uint16_t x)
+{
+        p[at] = x >> 8;
+        p[at + 1] = x;
+}
+
+// an E1.31 data packet, with just the fields DmxReceiver looks at filled in
+std::vector<uint8_t> e131(const uint16_t universe, const std::vector<uint8_t>& data)
+{
+        static const uint8_t id[] = "\x00\x10\x00\x00" "ASC-E1.17";
+
+        std::vector<uint8_t> p(126, 0);
+        memcpy(&p[0], id, sizeof id);
+        put16(p, 20, 4);
+        put16(p, 42, 2);
+        put16(p, 113, universe);
+        p[117] = 2;
+        put16(p, 123, data.size() + 1);
+        p.insert(p.end(), data.begin(), data.end());
+        return p;
+}
+
+// an ArtDmx packet for port-address universe - 1: Art-Net counts from 0,
+// sACN and the map from 1
+std::vector<uint8_t> artnet(const uint16_t universe, const std::vector<uint8_t>& data)
+{
+        std::vector<uint8_t> p(18, 0);
+        memcpy(&p[0], "Art-Net", 8);
+        p[8] = 0x00;
+        p[9] = 0x50;
+        put16(p, 10, 14);
+        p[14] = universe - 1;
+        p[15] = (universe - 1) >> 8;
+        put16(p, 16, data.size());
+        p.insert(p.end(), data.begin(), data.end());
+        return p;
+}
+
+void sendSlip(Stream& s, const std::vector<uint8_t>& p)
+{
+        std::vector<uint8_t> framed;
+        framed.push_back(0xc0);
+        for (uint8_t c : p) {
+                if (c == 0xc0) {
+                        framed.push_back(0xdb);
+                        framed.push_back(0xdc);
+                } else if (c == 0xdb) {
+                        framed.push_back(0xdb);
+                        framed.push_back(0xdd);
+                } else {
+                        framed.push_back(c);
+                }
+        }
+        framed.push_back(0xc0);
+        s.feed(framed.data(), framed.size());
+}
+
+void pollAll(DmxReceiver& dmx, Stream& s, Adafruit_DotStar& strip,
+             LedOutput& output)
+{
+        while (s.available())
+                dmx.poll(strip, output);
+}
+
+// scribble over the strip buffer, like a program rendering its next strip
+void scribble(Adafruit_DotStar& strip)
+{
+        memset(strip.getPixels(), 0x5a, 3*strip.numPixels());
+}
+
+// pixels [first, end) of a strip are pixels [0, end - first) of universe,
+// and the rest are black
+bool stripIs(const std::vector<uint32_t>& got, const uint16_t first,
+             const uint16_t end, const uint16_t universe)
+{
+        if (got.size() != NR_PIXELS)
+                return false;
+        for (uint16_t i = 0; i < NR_PIXELS; ++i) {
+                const uint32_t want = i >= first && i < end
+                        ? color(universe, i - first) : 0;
+                if (got[i] != want)
+                        return false;
+        }
+        return true;
+}
+
+}
+
+int main()
+{
+        // strip 0 is whole, strip 1 is split between universes 2 and 3,
+        // strip 2 starts partway along, and universe 9 is mapped to a strip
+        // we haven't got
+        const UniverseMapping map[] = {
+                {1, 0, 0},
+                {2, 1, 0},
+                {3, 1, 72},
+                {4, 2, 100},
+                {9, 7, 0}
+        };
+
+        Stream serial;
+        Adafruit_DotStar strip{NR_PIXELS, 0, 0, DOTSTAR_BGR};
+        CaptureOutput output;
+        uint8_t shadow[3*NR_PIXELS];
+        DmxReceiver dmx{serial, map, sizeof map/sizeof map[0], NR_STRIPS,
+                        shadow, sizeof shadow};
+
+        // a whole strip over E1.31, and again over Art-Net
+        sendSlip(serial, e131(1, slots(1, NR_PIXELS)));
+        pollAll(dmx, serial, strip, output);
+        CHECK(stripIs(output.shown[0], 0, NR_PIXELS, 1), "E1.31 strip 0 wrong");
+
+        scribble(strip);
+        sendSlip(serial, artnet(1, slots(1, 50)));
+        pollAll(dmx, serial, strip, output);
+        CHECK(stripIs(output.shown[0], 0, 50, 1), "Art-Net strip 0 wrong");
+
+        // the split strip, with other things rendered in between its halves,
+        // then the first half again
+        scribble(strip);
+        sendSlip(serial, e131(2, slots(2, 72)));
+        pollAll(dmx, serial, strip, output);
+        CHECK(stripIs(output.shown[1], 0, 72, 2), "first half of strip 1 wrong");
+
+        scribble(strip);
+        sendSlip(serial, artnet(3, slots(3, 72)));
+        pollAll(dmx, serial, strip, output);
+        for (uint16_t i = 0; i < NR_PIXELS; ++i) {
+                const uint32_t want = i < 72 ? color(2, i) : color(3, i - 72);
+                CHECK(output.shown[1][i] == want, "strip 1 pixel %u is %06x, want %06x",
+                      i, output.shown[1][i], want);
+        }
+
+        scribble(strip);
+        sendSlip(serial, e131(2, slots(2, 10)));
+        pollAll(dmx, serial, strip, output);
+        for (uint16_t i = 0; i < NR_PIXELS; ++i) {
+                const uint32_t want = i < 72 ? color(2, i) : color(3, i - 72);
+                CHECK(output.shown[1][i] == want, "strip 1 pixel %u is %06x, want %06x",
+                      i, output.shown[1][i], want);
+        }
+
+        // an offset that runs off the end of the strip
+        scribble(strip);
+        sendSlip(serial, e131(4, slots(4, 170)));
+        pollAll(dmx, serial, strip, output);
+        CHECK(stripIs(output.shown[2], 100, NR_PIXELS, 4), "strip 2 wrong");
+
+        // the same universe over both protocols lands in the same place:
+        // Art-Net port-address 1 is universe 2, the first half of strip 1
+        scribble(strip);
+        sendSlip(serial, artnet(2, slots(5, 72)));
+        pollAll(dmx, serial, strip, output);
+        for (uint16_t i = 0; i < NR_PIXELS; ++i) {
+                const uint32_t want = i < 72 ? color(5, i) : color(3, i - 72);
+                CHECK(output.shown[1][i] == want, "strip 1 pixel %u is %06x, want %06x",
+                      i, output.shown[1][i], want);
+        }
+        sendSlip(serial, e131(2, slots(6, 72)));
+        pollAll(dmx, serial, strip, output);
+        for (uint16_t i = 0; i < NR_PIXELS; ++i) {
+                const uint32_t want = i < 72 ? color(6, i) : color(3, i - 72);
+                CHECK(output.shown[1][i] == want, "strip 1 pixel %u is %06x, want %06x",
+                      i, output.shown[1][i], want);
+        }
+
+        // sACN universe 0 is reserved, and not Art-Net's 0
+        const unsigned before_zero = output.nr_shows;
+        sendSlip(serial, e131(0, slots(1, 10)));
+        pollAll(dmx, serial, strip, output);
+        CHECK(output.nr_shows == before_zero, "sACN universe 0 was shown");
+        CHECK(dmx.ignored() == 1, "%u ignored, want 1", (unsigned)dmx.ignored());
+
+        // a universe on a strip we haven't got, and one not in the map
+        const unsigned shows = output.nr_shows;
+        sendSlip(serial, e131(9, slots(9, 10)));
+        sendSlip(serial, artnet(5, slots(5, 10)));
+        pollAll(dmx, serial, strip, output);
+        CHECK(output.nr_shows == shows, "dropped packets were shown");
+        CHECK(dmx.unmapped() == 2, "%u unmapped, want 2", (unsigned)dmx.unmapped());
+
+        CHECK(dmx.packets() == 8, "%u packets, want 8", (unsigned)dmx.packets());
+        CHECK(dmx.bad() == 0 && dmx.ignored() == 1, "%u bad, %u ignored",
+              (unsigned)dmx.bad(), (unsigned)dmx.ignored());
+
+        return checkResult("dmx_test");
+}
@@ -0,0 +1,114 @@
+// frame_tracker_test.cpp
+//
+// FrameTracker.h and PixelHash.h: a strip whose pixels changed always gets
+// shown, including the +1, -2, +1 change on one channel of three pixels in a
+// row that the old Fletcher sums couldn't see, and a strip that didn't
+// change is still re-sent once a second however slow the frames are.
+
+#include <Arduino.h>
+
+#include "../FrameTracker.h"
+
+#include "check.h"
+
+#include <limits.h>
+#include <string.h>
+
+namespace {
+
+const uint16_t NR_PIXELS = 144;
+const uint16_t NR_BYTES = 3*NR_PIXELS;
+
+// the hash PixelHash.h used to have, to show the test case is the one
+// that fooled it
+uint32_t fletcher(const uint8_t *pixels, const uint16_t nr_bytes)
+{
+        uint16_t sum1 = 0;
+        uint16_t sum2 = 0;
+        for (uint16_t i = 0; i < nr_bytes; ++i) {
+                sum1 += pixels[i];
+                sum2 += sum1;
+        }
+        return ((uint32_t)sum2 << 16) | sum1;
+}
+
+}
+
+int main()
+{
+        uint8_t pixels[NR_BYTES];
+        uint8_t changed[NR_BYTES];
+
+        // the CRC-32 check value
+        const uint8_t check[] = "123456789";
+        CHECK(hashPixels(check, 9) == 0xcbf43926, "CRC-32 of \"123456789\" is %08lx",
+              (unsigned long)hashPixels(check, 9));
+
+        // +1, -2, +1 on every channel of every run of three pixels
+        randomSeed(51);
+        for (uint16_t i = 0; i < NR_BYTES; ++i)
+                pixels[i] = 2 + random(252);
+        const uint32_t hash = hashPixels(pixels, NR_BYTES);
+
+        unsigned fletcher_misses = 0;
+        unsigned misses = 0;
+        for (uint16_t i = 0; i + 6 < NR_BYTES; ++i) {
+                memcpy(changed, pixels, NR_BYTES);
+                ++changed[i];
+                changed[i + 3] -= 2;
+                ++changed[i + 6];
+                fletcher_misses += fletcher(changed, NR_BYTES)
+                        == fletcher(pixels, NR_BYTES);
+                misses += hashPixels(changed, NR_BYTES) == hash;
+        }
+        CHECK(fletcher_misses == NR_BYTES - 6, "the old hash only missed %u",
+              fletcher_misses);
+        CHECK(misses == 0, "missed %u +1/-2/+1 changes", misses);
+
+        // and every single bit
+        for (uint16_t i = 0; i < 8*NR_BYTES; ++i) {
+                memcpy(changed, pixels, NR_BYTES);
+                changed[i/8] ^= 1 << i%8;
+                CHECK(hashPixels(changed, NR_BYTES) != hash, "missed bit %u", i);
+        }
+
+        // the tracker: a collision-shaped change gets shown
+        FrameTracker<2> frames;
+        unsigned long now = 1000;
+        CHECK(frames.needsShow(0, pixels, NR_BYTES, 255, now), "first frame not shown");
+        CHECK(!frames.needsShow(0, pixels, NR_BYTES, 255, now), "same frame shown again");
+        memcpy(changed, pixels, NR_BYTES);
+        ++changed[30];
+        changed[33] -= 2;
+        ++changed[36];
+        CHECK(frames.needsShow(0, changed, NR_BYTES, 255, now),
+              "+1/-2/+1 change not shown");
+        CHECK(frames.needsShow(0, changed, NR_BYTES, 128, now),
+              "brightness change not shown");
+        CHECK(frames.needsShow(1, changed, NR_BYTES, 128, now),
+              "strip 1 skipped because of strip 0");
+
+        // one frame a second still gets re-sent every frame, and a fast
+        // frame rate every second
+        for (int f = 0; f < 5; ++f) {
+                now += 1000;
+                CHECK(frames.needsShow(0, changed, NR_BYTES, 128, now),
+                      "unchanged strip not re-sent after a second");
+        }
+        unsigned shown = 0;
+        for (int f = 0; f < 100; ++f) {
+                now += 25;
+                shown += frames.needsShow(0, changed, NR_BYTES, 128, now);
+        }
+        CHECK(shown == 2, "re-sent %u times in 2.5s at 40 frames a second", shown);
+
+        // across millis() wrapping
+        now = ULONG_MAX - 100;
+        CHECK(frames.needsShow(1, pixels, NR_BYTES, 0, now), "frame not shown");
+        CHECK(!frames.needsShow(1, pixels, NR_BYTES, 0, now + 500),
+              "re-sent early across the wrap");
+        CHECK(frames.needsShow(1, pixels, NR_BYTES, 0, now + 1000),
+              "not re-sent across the wrap");
+
+        return checkResult("frame_tracker_test");
+}
@@ -0,0 +1,78 @@
+// golden_test.cpp
+//
+// GoldenCheck.h run on a computer against golden_hashes.h, with exactly the
+// programs in programs.h: every program's output for the fixed inputs has to
+// match, and the table can't be empty.
+//
+// "golden_test print" prints a new golden_hashes.h instead, which is what
+// "make goldens" does. Only do that after a deliberate change in output, and
+// once the new output has been looked at on the strips.
+
+#include <Arduino.h>
+
+#include "../GoldenCheck.h"
+#include "../golden_hashes.h"
+#include "../programs.h"
+
+#include "check.h"
+
+namespace {
+
+// Print straight to stdout
+class StdoutPrint : public Print
+{
+public:
+        size_t write(const uint8_t c)
+        {
+                return fputc(c, stdout) == EOF ? 0 : 1;
+        }
+};
+
+void printTable(Adafruit_DotStar& strip)
+{
+        StdoutPrint out;
+
+        out.println(F("// golden_hashes.h"));
+        out.println(F("//"));
+        out.println(F("// Known good hashes for GoldenCheck, a line per strip in the order it"));
+        out.println(F("// renders them, each strip in segments of 16 pixels."));
+        out.println(F("//"));
+        out.println(F("// Made by \"make goldens\" in test/, which renders programs.h on a"));
+        out.println(F("// computer with avr-libc's random(). Don't edit it by hand, and only"));
+        out.println(F("// remake it once a change in output has been checked by eye."));
+        out.println();
+        out.println(F("#pragma once"));
+        out.println();
+        out.println(F("#include <Arduino.h>"));
+        out.println();
+        out.println(F("const uint16_t golden_hashes[] PROGMEM = {"));
+        GoldenCheck::run(progs, nr_progs, strip, TableLayout::nr_strips,
+                         NULL, 0, out);
+        out.println(F("};"));
+        out.println();
+        out.println(F("const uint16_t nr_golden_hashes = sizeof golden_hashes/sizeof golden_hashes[0];"));
+}
+
+}
+
+int main(int argc, char **argv)
+{
+        Adafruit_DotStar strip{TableLayout::leds_per_strip,
+                               TableLayout::color_order};
+
+        if (argc > 1 && !strcmp(argv[1], "print")) {
+                printTable(strip);
+                return 0;
+        }
+
+        Print out;
+        const uint16_t mismatches = GoldenCheck::run(progs, nr_progs, strip,
+                                                     TableLayout::nr_strips,
+                                                     golden_hashes,
+                                                     nr_golden_hashes, out);
+
+        CHECK(mismatches == 0, "%u strips differ from golden_hashes.h:\n%s",
+              mismatches, out.out.c_str());
+
+        return checkResult("golden_test");
+}
@@ -0,0 +1,78 @@
+// histogram_test.cpp
+//
+// FrameTimeHistogram.h's buckets and percentiles: frame times 25% apart land
+// in different buckets, a 40% slower run reads as about 40% slower, and an
+// interpolated percentile is within a bucket's width of the real one.
+
+#include <Arduino.h>
+
+#include "../FrameTimeHistogram.h"
+
+#include "check.h"
+
+#include <string>
+
+namespace {
+
+// the number after name= in the summary line
+unsigned long field(const std::string& out, const char *name)
+{
+        const size_t at = out.find(name);
+        if (at == std::string::npos)
+                return 0;
+        return strtoul(out.c_str() + at + strlen(name), NULL, 10);
+}
+
+unsigned long p50(const FrameTimeHistogram& h)
+{
+        Print out;
+        h.print(out);
+        return field(out.out, " p50_us=");
+}
+
+unsigned long p99(const FrameTimeHistogram& h)
+{
+        Print out;
+        h.print(out);
+        return field(out.out, " p99_us=");
+}
+
+}
+
+int main()
+{
+        // one frame time, over and over, is its own percentile
+        const uint32_t times[] = {0, 1, 3, 4, 7, 100, 8200, 11500, 16400, 999999};
+        for (uint32_t t : times) {
+                FrameTimeHistogram h;
+                for (uint8_t i = 0; i < 10; ++i)
+                        h.add(t);
+                CHECK(p50(h) == t && p99(h) == t, "%u us every frame gave p50 %lu p99 %lu",
+                      t, p50(h), p99(h));
+        }
+
+        // a run 40% slower than another, with some spread in both
+        FrameTimeHistogram fast;
+        FrameTimeHistogram slow;
+        randomSeed(60);
+        for (uint16_t i = 0; i < 1000; ++i) {
+                const uint32_t t = 8200 + random(1000);
+                fast.add(t);
+                slow.add(t*14/10);
+        }
+        const double ratio = (double)p50(slow)/p50(fast);
+        CHECK(ratio > 1.3 && ratio < 1.5, "p50s %lu and %lu are %.2fx apart, want about 1.4x",
+              p50(fast), p50(slow), ratio);
+
+        // evenly spread times: the interpolated median is close to the
+        // real one, not the top of its bucket
+        FrameTimeHistogram even;
+        for (uint32_t t = 8000; t < 12000; ++t)
+                even.add(t);
+        CHECK(p50(even) > 9800 && p50(even) < 10200, "p50 of 8000-11999 is %lu",
+              p50(even));
+        CHECK(p99(even) > 11700 && p99(even) <= 11999, "p99 of 8000-11999 is %lu",
+              p99(even));
+
+        return checkResult("histogram_test");
+}
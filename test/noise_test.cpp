@@ -0,0 +1,181 @@
+// noise_test.cpp
+//
+// Noise.h run with the AVR's 16 bit int (see avr_int.h), against the same
+// algorithm in doubles: no signed overflow anywhere, every result within a
+// few LSBs of the reference, and NoiseLine exactly equal to noise3().
+
+#include <Arduino.h>
+
+#include "avr_int.h"
+
+#define uint8_t avr::T<avr::U8>
+#define int16_t avr::T<avr::INT>
+#define uint16_t avr::T<avr::UINT>
+#define int32_t avr::T<avr::LONG>
+#define uint32_t avr::T<avr::ULONG>
+
+#include "../Noise.h"
+
+#undef uint8_t
+#undef int16_t
+#undef uint16_t
+#undef int32_t
+#undef uint32_t
+
+#include "check.h"
+
+#include <math.h>
+
+namespace {
+
+// 32 LSBs of full scale. Fixed point rounding puts us within about 12.
+const double TOLERANCE = 32.0/32768;
+
+uint8_t p(const int i)
+{
+        return noise::PERM[i & 255].v;
+}
+
+double fade(const double t)
+{
+        return t*t*(3 - 2*t);
+}
+
+double lerp(const double a, const double b, const double t)
+{
+        return a + (b - a)*t;
+}
+
+double grad3(const int hash, const double x, const double y, const double z)
+{
+        const int h = hash & 15;
+        const double u = h < 8 ? x : y;
+        const double v = h < 4 ? y : h == 12 || h == 14 ? x : z;
+        return ((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+}
+
+double grad1(const int hash, const double x)
+{
+        const double g = x*((hash & 7) + 1)/8;
+        return (hash & 8) ? -g : g;
+}
+
+// scaled like Noise.h's: full scale is +-1
+double ref1(const double x)
+{
+        const int X = floor(x);
+        const double f = x - X;
+        return 2*lerp(grad1(p(X), f), grad1(p(X + 1), f - 1), fade(f));
+}
+
+double ref3(double x, double y, double z)
+{
+        const int X = floor(x), Y = floor(y), Z = floor(z);
+        x -= X;
+        y -= Y;
+        z -= Z;
+
+        const uint8_t A = p(X) + Y, AA = p(A) + Z, AB = p(A + 1) + Z;
+        const uint8_t B = p(X + 1) + Y, BA = p(B) + Z, BB = p(B + 1) + Z;
+        const double u = fade(x), v = fade(y), w = fade(z);
+
+        return lerp(lerp(lerp(grad3(p(AA), x, y, z), grad3(p(BA), x - 1, y, z), u),
+                         lerp(grad3(p(AB), x, y - 1, z), grad3(p(BB), x - 1, y - 1, z), u), v),
+                    lerp(lerp(grad3(p(AA + 1), x, y, z - 1), grad3(p(BA + 1), x - 1, y, z - 1), u),
+                         lerp(grad3(p(AB + 1), x, y - 1, z - 1), grad3(p(BB + 1), x - 1, y - 1, z - 1), u), v),
+                    w);
+}
+
+double clip(const double x)
+{
+        return x > 32767.0/32768 ? 32767.0/32768 : x < -1 ? -1 : x;
+}
+
+double unit(const avr::Num& n)
+{
+        return n.v/32768.0;
+}
+
+// 16.16 coordinates, mostly random but with plenty of exact lattice points
+// and cell edges, which is where things overflow
+uint32_t coordinate()
+{
+        uint32_t c = ((uint32_t)random() << 1 ^ random()) & 0xffffff;
+        switch (random(4)) {
+        case 0:
+                return c & 0xff0000;
+        case 1:
+                return c | 0xffff;
+        default:
+                return c;
+        }
+}
+
+}
+
+int main()
+{
+        randomSeed(74);
+
+        const long n = 200000;
+        double err1 = 0, err2 = 0, err3 = 0;
+        for (long i = 0; i < n; ++i) {
+                const uint32_t x = coordinate(), y = coordinate(), z = coordinate();
+                const double fx = x/65536.0, fy = y/65536.0, fz = z/65536.0;
+
+                err1 = fmax(err1, fabs(unit(Noise::noise1(x)) - clip(ref1(fx))));
+                err2 = fmax(err2, fabs(unit(Noise::noise2(x, y)) - clip(ref3(fx, fy, 0))));
+                err3 = fmax(err3, fabs(unit(Noise::noise3(x, y, z)) - clip(ref3(fx, fy, fz))));
+        }
+
+        CHECK(err1 <= TOLERANCE, "noise1 off by %g", err1);
+        CHECK(err2 <= TOLERANCE, "noise2 off by %g", err2);
+        CHECK(err3 <= TOLERANCE, "noise3 off by %g", err3);
+
+        long line_mismatches = 0;
+        for (int k = 0; k < 2000; ++k) {
+                const uint32_t x = coordinate(), y = coordinate(), z = coordinate();
+                const uint32_t dx = 1 + random(20000);
+
+                NoiseLine line{x, dx, y, z};
+                for (uint32_t i = 0; i < 144; ++i) {
+                        const long a = line.next().v;
+                        const long b = Noise::noise3(x + i*dx, y, z).v;
+                        line_mismatches += a != b;
+                }
+        }
+        CHECK(line_mismatches == 0, "%ld NoiseLine points differ from noise3()",
+              line_mismatches);
+
+        CHECK(avr::overflows() == 0, "%lu signed overflows", avr::overflows());
+
+        // what a point costs on the board, in multiplies: a whole noise3(),
+        // and a pixel of NoiseLine along a strip
+        const int points = 10000;
+        avr::multiplies() = {0, 0};
+        for (int i = 0; i < points; ++i)
+                Noise::noise3(coordinate(), coordinate(), coordinate());
+        const avr::Multiplies full = avr::multiplies();
+
+        avr::multiplies() = {0, 0};
+        for (int k = 0; k < points/144; ++k) {
+                NoiseLine line{coordinate(), 1 + random(20000), coordinate(),
+                               coordinate()};
+                for (int i = 0; i < 144; ++i)
+                        line.next();
+        }
+        const avr::Multiplies along = avr::multiplies();
+        const int line_points = points/144*144;
+
+        // Noise.h's comment quotes these, keep it up to date
+        CHECK(full.m32 <= 19UL*points, "noise3() got more expensive");
+        CHECK(along.m32 <= 12UL*line_points, "NoiseLine got more expensive");
+
+        printf("multiplies per point: noise3 %.1f 16 bit + %.1f 32 bit, "
+               "NoiseLine %.1f + %.1f\n",
+               (double)full.m16/points, (double)full.m32/points,
+               (double)along.m16/line_points, (double)along.m32/line_points);
+
+        printf("max error: noise1 %.5f noise2 %.5f noise3 %.5f\n", err1, err2, err3);
+        return checkResult("noise_test");
+}
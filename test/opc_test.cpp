@@ -0,0 +1,143 @@
+// opc_test.cpp
+//
+// OpcReceiver.h fed a stream of set-pixel-colors messages with bytes missing,
+// the way a 1Mbaud client loses them while a strip is being shown: the
+// message a byte went missing from, and the one after it, may be wrong, but
+// the receiver finds a header again and the messages after that are right.
+// Also a sender that stops half way, and a full receive ring being counted.
+
+#include <Arduino.h>
+
+#include "../OpcReceiver.h"
+
+#include "check.h"
+
+#include <vector>
+
+namespace {
+
+const uint8_t NR_STRIPS = 4;
+const uint16_t NR_PIXELS = 144;
+
+// what each strip was last shown as
+class CaptureOutput : public LedOutput
+{
+public:
+        std::vector<uint32_t> shown[NR_STRIPS];
+        unsigned nr_shows = 0;
+
+        void show(Adafruit_DotStar& strip, const uint8_t strip_nr)
+        {
+                ++nr_shows;
+                CHECK(strip_nr < NR_STRIPS, "showed strip %u", strip_nr);
+                if (strip_nr >= NR_STRIPS)
+                        return;
+
+                shown[strip_nr].clear();
+                for (uint16_t i = 0; i < strip.numPixels(); ++i)
+                        shown[strip_nr].push_back(strip.getPixelColor(i));
+        }
+};
+
+// a recognizable color for pixel i of message m
+uint32_t color(const uint8_t m, const uint16_t i)
+{
+        return Adafruit_DotStar::Color(m, i >> 8, i);
+}
+
+std::vector<uint8_t> message(const uint8_t channel, const uint8_t m)
+{
+        std::vector<uint8_t> p = {channel, 0, (3*NR_PIXELS) >> 8,
+                                  (3*NR_PIXELS) & 0xff};
+        for (uint16_t i = 0; i < NR_PIXELS; ++i) {
+                const uint32_t c = color(m, i);
+                p.push_back(c >> 16);
+                p.push_back(c >> 8);
+                p.push_back(c);
+        }
+        return p;
+}
+
+bool stripIs(const std::vector<uint32_t>& got, const uint8_t m)
+{
+        if (got.size() != NR_PIXELS)
+                return false;
+        for (uint16_t i = 0; i < NR_PIXELS; ++i)
+                if (got[i] != color(m, i))
+                        return false;
+        return true;
+}
+
+void pollAll(OpcReceiver& opc, Stream& s, Adafruit_DotStar& strip,
+             LedOutput& output)
+{
+        while (s.available())
+                opc.poll(strip, output);
+}
+
+}
+
+int main()
+{
+        Stream serial;
+        Adafruit_DotStar strip{NR_PIXELS, 0, 0, DOTSTAR_BGR};
+        CaptureOutput output;
+        OpcReceiver opc{serial, NR_STRIPS};
+
+        // a clean message to each strip
+        for (uint8_t s = 0; s < NR_STRIPS; ++s) {
+                const std::vector<uint8_t> m = message(s, s + 1);
+                serial.feed(m.data(), m.size());
+        }
+        pollAll(opc, serial, strip, output);
+        for (uint8_t s = 0; s < NR_STRIPS; ++s)
+                CHECK(stripIs(output.shown[s], s + 1), "strip %u wrong", s);
+        CHECK(opc.resyncs() == 0, "%u resyncs on a clean stream",
+              (unsigned)opc.resyncs());
+
+        // lose a byte from the middle of a message, at the start of one,
+        // and in a header: each time the second message after is right
+        const size_t losses[] = {200, 0, 2};
+        for (uint8_t l = 0; l < 3; ++l) {
+                std::vector<uint8_t> bad = message(1, 10 + l);
+                bad.erase(bad.begin() + losses[l]);
+                const std::vector<uint8_t> eaten = message(1, 15);
+                const std::vector<uint8_t> good = message(2, 20 + l);
+                serial.feed(bad.data(), bad.size());
+                serial.feed(eaten.data(), eaten.size());
+                serial.feed(good.data(), good.size());
+                pollAll(opc, serial, strip, output);
+
+                CHECK(stripIs(output.shown[2], 20 + l),
+                      "strip 2 wrong after losing byte %zu of a message",
+                      losses[l]);
+                CHECK(opc.resyncs() == l + 1u, "%u resyncs, want %u",
+                      (unsigned)opc.resyncs(), l + 1u);
+        }
+        CHECK(!opc.busy(millis()), "still busy after the stream recovered");
+
+        // a sender that stops half way: busy until the receiver gives up
+        const std::vector<uint8_t> half = message(3, 30);
+        serial.feed(half.data(), half.size()/2);
+        pollAll(opc, serial, strip, output);
+        CHECK(opc.busy(millis()), "not busy half way through a message");
+        fakeMicros() += 200000;
+        CHECK(opc.poll(strip, output), "giving up didn't say the buffer was clobbered");
+        CHECK(!opc.busy(millis()), "still busy after giving up");
+
+        const std::vector<uint8_t> next = message(3, 31);
+        serial.feed(next.data(), next.size());
+        pollAll(opc, serial, strip, output);
+        CHECK(stripIs(output.shown[3], 31), "strip 3 wrong after a stalled message");
+
+        // a full receive ring means bytes were dropped
+        const unsigned long overruns = opc.overruns();
+        const std::vector<uint8_t> m = message(0, 40);
+        serial.feed(m.data(), m.size());
+        opc.poll(strip, output);
+        CHECK(opc.overruns() == overruns + 1, "a full ring wasn't counted");
+        pollAll(opc, serial, strip, output);
+        CHECK(stripIs(output.shown[0], 40), "strip 0 wrong");
+
+        return checkResult("opc_test");
+}
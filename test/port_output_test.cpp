@@ -0,0 +1,113 @@
+// port_output_test.cpp
+//
+// PortOutput.h's pin writes, followed edge by edge and decoded the way an
+// APA102 strip would decode them: data is sampled on each rising clock edge.
+// The bytes have to be valid APA102 and match the pixels at the strip's
+// brightness, and showing one strip mustn't touch another strip's pins, even
+// when they share a port.
+
+#include <Arduino.h>
+
+#include "../PortOutput.h"
+
+#include "apa102_checker.h"
+#include "check.h"
+
+#include <vector>
+
+namespace {
+
+const uint8_t NR_STRIPS = 3;
+const uint16_t NR_PIXELS = 144;
+
+// strips 0 and 1 share a port, strip 2's pins are on two other ports
+const uint8_t DATA_PINS[NR_STRIPS] = {3, 5, 10};
+const uint8_t CLK_PINS[NR_STRIPS] = {4, 6, 21};
+
+bool level(const uint8_t pin)
+{
+        return fakePorts()[digitalPinToPort(pin)] & digitalPinToBitMask(pin);
+}
+
+// what each strip's pins did
+struct Wire
+{
+        bool clk = false;
+        bool data = false;
+        uint8_t bits = 0;
+        uint8_t byte = 0;
+        std::vector<uint8_t> bytes;
+};
+
+Wire wires[NR_STRIPS];
+uint8_t showing = 0;
+unsigned stray_edges = 0;
+
+void watch(const uint8_t port)
+{
+        (void)port;
+
+        for (uint8_t s = 0; s < NR_STRIPS; ++s) {
+                Wire& w = wires[s];
+                const bool clk = level(CLK_PINS[s]);
+                const bool data = level(DATA_PINS[s]);
+
+                if (s != showing && (clk != w.clk || data != w.data))
+                        ++stray_edges;
+
+                if (clk && !w.clk) {
+                        w.byte = w.byte << 1 | data;
+                        if (++w.bits == 8) {
+                                w.bytes.push_back(w.byte);
+                                w.bits = 0;
+                        }
+                }
+                w.clk = clk;
+                w.data = data;
+        }
+}
+
+}
+
+int main()
+{
+        Adafruit_DotStar strip{NR_PIXELS, 0, 0, DOTSTAR_BGR};
+        PortOutput output{DATA_PINS, CLK_PINS, NR_STRIPS};
+
+        output.begin();
+        portWatcher() = watch;
+
+        const uint8_t brightnesses[] = {255, 128, 0, 31};
+        randomSeed(62);
+
+        for (uint8_t b = 0; b < sizeof brightnesses; ++b) {
+                for (showing = 0; showing < NR_STRIPS; ++showing) {
+                        Wire& w = wires[showing];
+                        w.bytes.clear();
+
+                        for (uint16_t i = 0; i < 3*NR_PIXELS; ++i)
+                                strip.getPixels()[i] = random(256);
+                        strip.setBrightness(brightnesses[b]);
+
+                        output.show(strip, showing);
+
+                        Apa102Checker checker{NR_PIXELS};
+                        for (uint8_t c : w.bytes)
+                                checker.add(c);
+
+                        CHECK(checker.ok(), "strip %u at brightness %u isn't valid APA102",
+                              showing, brightnesses[b]);
+                        CHECK(w.bytes == apa102Frame(strip, brightnesses[b]),
+                              "strip %u at brightness %u sent the wrong bytes",
+                              showing, brightnesses[b]);
+                        CHECK(w.bits == 0, "strip %u was left %u bits into a byte",
+                              showing, w.bits);
+                        CHECK(!w.clk, "strip %u's clock was left high", showing);
+                }
+        }
+
+        CHECK(stray_edges == 0, "%u edges on strips that weren't being shown",
+              stray_edges);
+
+        return checkResult("port_output_test");
+}
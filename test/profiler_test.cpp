@@ -0,0 +1,107 @@
+// profiler_test.cpp
+//
+// StageProfiler.h with a fake timer 3: tick() does what the board's timer
+// does every 1.004ms, moving the clock on and, once begin() has enabled the
+// compare interrupt, calling the ISR. Samples have to land in whatever
+// stage the code is in, nested stages have to hand back to the outer one,
+// and print() has to turn samples and counted items into percentages and
+// ns per item.
+
+#include <Arduino.h>
+
+#include "../StageProfiler.h"
+
+#include "check.h"
+
+#include <string>
+
+namespace {
+
+// one compare match of timer 3: 251 ticks of 4us
+void tick(const unsigned n = 1)
+{
+        for (unsigned i = 0; i < n; ++i) {
+                fakeMicros() += 1004;
+                if (TIMSK3 & _BV(OCIE3A))
+                        TIMER3_COMPA_vect();
+        }
+}
+
+class StringPrint : public Print
+{
+public:
+        std::string text;
+
+        size_t write(const uint8_t c)
+        {
+                text += (char)c;
+                return 1;
+        }
+};
+
+std::string profile()
+{
+        StringPrint out;
+        StageProfiler::print(out);
+        return out.text;
+}
+
+bool has(const std::string& text, const char *line)
+{
+        return text.find(line) != std::string::npos;
+}
+
+}
+
+int main()
+{
+        // nothing until the timer's set up
+        tick(10);
+        CHECK(has(profile(), "profile samples=0\r\n"), "sampled before begin():\n%s",
+              profile().c_str());
+
+        StageProfiler::begin();
+        CHECK(TCCR3B == (_BV(WGM32) | _BV(CS31) | _BV(CS30)) && OCR3A == 250,
+              "timer 3 isn't CTC, clk/64, 251 ticks");
+
+        // 10 idle, 20 rendering of which 5 are in an ISR, 10 showing, and
+        // 10 more idle
+        tick(10);
+        {
+                ProfileStage render{StageProfiler::RENDER};
+                tick(10);
+                {
+                        ProfileStage isr{StageProfiler::ENCODER_ISR};
+                        tick(5);
+                }
+                tick(5);
+                StageProfiler::count(StageProfiler::RENDER, 1000);
+        }
+        {
+                ProfileStage show{StageProfiler::SHOW};
+                tick(10);
+        }
+        tick(10);
+
+        // 15 samples over 1000 items is 15 * 1.004ms / 1000
+        const std::string p = profile();
+        CHECK(has(p, "profile samples=50\r\n"), "wrong total:\n%s", p.c_str());
+        CHECK(has(p, "  idle: 20 (40%)\r\n"), "wrong idle:\n%s", p.c_str());
+        CHECK(has(p, "  render: 15 (30%) 15060ns/item\r\n"), "wrong render:\n%s",
+              p.c_str());
+        CHECK(has(p, "  encoder_isr: 5 (10%)\r\n"), "wrong isr:\n%s", p.c_str());
+        CHECK(has(p, "  show: 10 (20%)\r\n"), "wrong show:\n%s", p.c_str());
+        CHECK(has(p, "  blend: 0 (0%)\r\n"), "wrong blend:\n%s", p.c_str());
+
+        // reset clears samples and items together
+        StageProfiler::reset();
+        CHECK(has(profile(), "profile samples=0\r\n"), "reset didn't clear");
+        {
+                ProfileStage render{StageProfiler::RENDER};
+                tick(2);
+        }
+        CHECK(has(profile(), "  render: 2 (100%)\r\n"),
+              "items survived reset:\n%s", profile().c_str());
+
+        return checkResult("profiler_test");
+}
@@ -0,0 +1,121 @@
+// scope_marker_test.cpp
+//
+// ScopeMarker.h with the markers turned on, on the fake port A: every
+// change to the port is logged through portWatcher(), with the time, the
+// way a logic analyser on pins 22-25 would see it. The markers have to come
+// out as pulses nested like the code they wrap, and only on their own bits.
+//
+// "scope_marker_test -v" prints the log.
+
+#define LED_MONGER_SCOPE_MARKERS
+
+#include <Arduino.h>
+
+#include "../ScopeMarker.h"
+
+#include "check.h"
+
+#include <string.h>
+#include <vector>
+
+namespace {
+
+struct Edge
+{
+        unsigned long micros;
+        uint8_t bit;
+        bool high;
+};
+
+std::vector<Edge> edges;
+uint8_t port_a = 0;
+
+const char *const names[] = {"frame", "render", "show", "encoder_isr"};
+
+// log each marker that changed
+void watch(const uint8_t port)
+{
+        if (port != FAKE_PORT_A)
+                return;
+
+        const uint8_t now = fakePorts()[FAKE_PORT_A];
+        for (uint8_t b = 0; b < 8; ++b)
+                if ((now ^ port_a) & _BV(b))
+                        edges.push_back({micros(), b, (bool)(now & _BV(b))});
+        port_a = now;
+}
+
+// how long marker bit was high, the n-th time
+long pulse(const uint8_t bit, const unsigned n)
+{
+        unsigned seen = 0;
+        unsigned long rose = 0;
+        for (const Edge& e : edges) {
+                if (e.bit != bit)
+                        continue;
+                if (e.high)
+                        rose = e.micros;
+                else if (seen++ == n)
+                        return e.micros - rose;
+        }
+        return -1;
+}
+
+}
+
+int main(int argc, char **argv)
+{
+        // left high by whatever ran before boot
+        fakePorts()[FAKE_PORT_A] = 0xff;
+        port_a = 0xff;
+        portWatcher() = watch;
+
+        beginScopeMarkers();
+        CHECK(DDRA == 0x0f, "DDRA is %02x, want the 4 marker bits", DDRA);
+        CHECK(fakePorts()[FAKE_PORT_A] == 0xf0, "port A is %02x after begin",
+              fakePorts()[FAKE_PORT_A]);
+        edges.clear();
+
+        // a frame of two strips, each rendered then shown, with an encoder
+        // interrupt in the middle of the second render
+        ScopeMarker<SCOPE_FRAME>::high();
+        for (uint8_t s = 0; s < 2; ++s) {
+                fakeMicros() += 10;
+                {
+                        ScopeMarker<SCOPE_RENDER> mark;
+                        fakeMicros() += 300;
+                        if (s == 1) {
+                                ScopeMarker<SCOPE_ENCODER_ISR> isr;
+                                fakeMicros() += 5;
+                        }
+                        fakeMicros() += 200;
+                }
+                {
+                        ScopeMarker<SCOPE_SHOW> mark;
+                        fakeMicros() += 1000;
+                }
+        }
+        ScopeMarker<SCOPE_FRAME>::low();
+
+        if (argc > 1 && !strcmp(argv[1], "-v"))
+                for (const Edge& e : edges)
+                        printf("%8luus %-11s %s\n", e.micros, names[e.bit],
+                               e.high ? "high" : "low");
+
+        CHECK(edges.size() == 2*(1 + 2 + 2 + 1), "%zu edges", edges.size());
+        CHECK(pulse(SCOPE_FRAME, 0) == 2*(10 + 1000) + 500 + 505,
+              "frame pulse %ld", pulse(SCOPE_FRAME, 0));
+        CHECK(pulse(SCOPE_RENDER, 0) == 500 && pulse(SCOPE_RENDER, 1) == 505,
+              "render pulses %ld %ld", pulse(SCOPE_RENDER, 0),
+              pulse(SCOPE_RENDER, 1));
+        CHECK(pulse(SCOPE_SHOW, 0) == 1000 && pulse(SCOPE_SHOW, 1) == 1000,
+              "show pulses %ld %ld", pulse(SCOPE_SHOW, 0), pulse(SCOPE_SHOW, 1));
+        CHECK(pulse(SCOPE_ENCODER_ISR, 0) == 5, "isr pulse %ld",
+              pulse(SCOPE_ENCODER_ISR, 0));
+        CHECK(fakePorts()[FAKE_PORT_A] == 0xf0,
+              "port A is %02x after the frame, markers left high or other bits "
+              "touched", fakePorts()[FAKE_PORT_A]);
+
+        portWatcher() = NULL;
+        return checkResult("scope_marker_test");
+}
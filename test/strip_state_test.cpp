@@ -0,0 +1,122 @@
+// strip_state_test.cpp
+//
+// StripState.h: a program's per-strip slots are zeroed whenever it's
+// activated, and each strip's slot survives rendering the other strips into
+// the same buffer, frame after frame. BreatheProg is the program: each
+// strip's phase has to move on by exactly its own rate each frame, and its
+// rate and color change at the bottom of each breath.
+
+#include <Arduino.h>
+
+#include "../StripState.h"
+
+#include "check.h"
+
+#include <string.h>
+
+namespace {
+
+const uint8_t NR_STRIPS = 4;
+const uint16_t NR_PIXELS = 144;
+
+// 63*16, so a breath goes 1 + 63 times its rate a frame
+const uint16_t FREQ = 1008;
+
+// lets the test see the slots
+class Probe : public BreatheProg<NR_STRIPS>
+{
+public:
+        using StripStateProg<BreatheState, NR_STRIPS>::state;
+};
+
+bool isZero(const BreatheState& s)
+{
+        const BreatheState zero = {};
+        return !memcmp(&s, &zero, sizeof s);
+}
+
+// at a steady frequency, so freq_sum is frame*freq
+void renderFrame(Probe& prog, Adafruit_DotStar& strip, const uint32_t frame,
+                 const uint16_t freq)
+{
+        LedProgram::startFrame({frame, frame*(uint32_t)freq});
+        for (uint8_t i = 0; i < NR_STRIPS; ++i)
+                prog.updateStrip(strip, i, 512, freq);
+}
+
+}
+
+int main()
+{
+        Adafruit_DotStar strip{NR_PIXELS, 0, 0, DOTSTAR_BGR};
+        Probe prog;
+
+        // garbage in every slot, then activate
+        for (uint8_t i = 0; i < NR_STRIPS; ++i)
+                memset(&prog.state(i), 0xa5, sizeof(BreatheState));
+        prog.activate();
+        for (uint8_t i = 0; i < NR_STRIPS; ++i)
+                CHECK(isZero(prog.state(i)), "strip %u's slot not zeroed", i);
+
+        // the first frame sets every strip up, each differently
+        renderFrame(prog, strip, 1, FREQ);
+        for (uint8_t i = 0; i < NR_STRIPS; ++i) {
+                CHECK(prog.state(i).rate != 0, "strip %u not set up", i);
+                for (uint8_t j = 0; j < i; ++j)
+                        CHECK(prog.state(i).phase != prog.state(j).phase,
+                              "strips %u and %u in the same phase", i, j);
+        }
+
+        // frame by frame each strip moves on by its own rate, with the
+        // other strips rendered in between; at FREQ that's 64 rates a
+        // frame. Count breaths and the rates and hues they pick.
+        unsigned new_paces = 0;
+        for (uint32_t f = 2; f < 400; ++f) {
+                BreatheState before[NR_STRIPS];
+                for (uint8_t i = 0; i < NR_STRIPS; ++i)
+                        before[i] = prog.state(i);
+
+                renderFrame(prog, strip, f, FREQ);
+
+                for (uint8_t i = 0; i < NR_STRIPS; ++i) {
+                        const BreatheState& s = prog.state(i);
+                        const uint16_t want = before[i].phase + 64*before[i].rate;
+                        CHECK(s.phase == want, "frame %u strip %u phase %u, want %u",
+                              (unsigned)f, i, s.phase, want);
+                        CHECK(s.frame == (uint16_t)f, "frame %u strip %u not moved on",
+                              (unsigned)f, i);
+
+                        const bool wrapped = s.phase < before[i].phase;
+                        CHECK(s.breaths == (uint8_t)(before[i].breaths + wrapped),
+                              "frame %u strip %u breaths %u", (unsigned)f, i,
+                              s.breaths);
+                        if (!wrapped)
+                                CHECK(s.rate == before[i].rate && s.hue == before[i].hue,
+                                      "frame %u strip %u changed pace mid breath",
+                                      (unsigned)f, i);
+                        else
+                                new_paces += s.rate != before[i].rate
+                                        || s.hue != before[i].hue;
+                }
+        }
+        CHECK(new_paces > 10, "only %u new paces", new_paces);
+
+        // the buffer shows the last strip rendered, at its own state
+        renderFrame(prog, strip, 400, FREQ);
+        const uint32_t last = strip.getPixelColor(0);
+        prog.updateStrip(strip, 0, 512, FREQ);
+        prog.updateStrip(strip, NR_STRIPS - 1, 512, FREQ);
+        CHECK(strip.getPixelColor(0) == last,
+              "re-rendering strips in the same frame moved them on");
+
+        // activating again starts over
+        prog.activate();
+        for (uint8_t i = 0; i < NR_STRIPS; ++i)
+                CHECK(isZero(prog.state(i)), "strip %u's slot not zeroed again", i);
+
+        // strips past NrStrips have no slot, and are blank
+        prog.updateStrip(strip, NR_STRIPS, 512, FREQ);
+        CHECK(strip.getPixelColor(0) == 0, "strip %u not blank", NR_STRIPS);
+
+        return checkResult("strip_state_test");
+}
@@ -0,0 +1,176 @@
+// sync_test.cpp
+//
+// FrameSync.h with a leader and a follower joined by a wire: the follower's
+// corrections slew by a quarter of the phase error and never more than an
+// eighth of a frame, it starts over when it's more than two frames out, and
+// frame numbers and millis() wrapping around don't throw it. Then a follower
+// running StripScheduler the way led_monger.ino does, started out of step,
+// has to pull into step with the leader and stay there.
+//
+// On the computer unsigned long is 64 bits where the board's is 32, so
+// millis() wrapping is tested at 64 bits; the arithmetic is the same.
+
+#include <Arduino.h>
+
+#include "../FrameSync.h"
+#include "../StripScheduler.h"
+
+#include "check.h"
+
+#include <limits.h>
+
+namespace {
+
+const unsigned long INTERVAL = 40;
+
+// whatever the leader writes, the follower reads
+class Wire : public Stream
+{
+public:
+        size_t write(const uint8_t c)
+        {
+                in += (char)c;
+                return 1;
+        }
+};
+
+void setMillis(const unsigned long ms)
+{
+        fakeMicros() = 0;
+        fakeMillisOffset() = ms;
+}
+
+// the leader starts frame number "frame" now, and the follower hears it
+void leaderFrame(SyncLeader& leader, SyncFollower& follower, const uint32_t frame)
+{
+        leader.frameStarted({frame, frame*100u, 3, 100, 512});
+        follower.poll();
+}
+
+}
+
+int main()
+{
+        Wire wire;
+        SyncLeader leader{wire};
+        SyncFollower follower{wire};
+        bool restart;
+
+        // the packet gets there
+        setMillis(1000);
+        leaderFrame(leader, follower, 100);
+        CHECK(follower.packets() == 1 && follower.bad() == 0, "%u packets, %u bad",
+              (unsigned)follower.packets(), (unsigned)follower.bad());
+        CHECK(follower.locked(millis()), "not locked after a packet");
+        CHECK(follower.leader().frame == 100 && follower.leader().prog == 3
+              && follower.leader().freq == 100 && follower.leader().brightness == 512,
+              "packet fields wrong");
+        CHECK(follower.freqSumAt(102) == 10200 && follower.freqSumAt(99) == 9900,
+              "freqSumAt() wrong");
+        CHECK(follower.leaderMillis() == 1000, "leader started at %lu, want 1000",
+              follower.leaderMillis());
+
+        // a quarter of the error...
+        long slew = follower.correction(100, 1008, INTERVAL, restart);
+        CHECK(!restart && slew == -2, "8ms behind slewed %ld, want -2", slew);
+        CHECK(follower.correction(100, 1008, INTERVAL, restart) == 0,
+              "corrected twice for one packet");
+
+        leaderFrame(leader, follower, 100);
+        slew = follower.correction(100, 992, INTERVAL, restart);
+        CHECK(!restart && slew == 2, "8ms ahead slewed %ld, want 2", slew);
+
+        // ...but no more than an eighth of a frame
+        leaderFrame(leader, follower, 100);
+        slew = follower.correction(100, 1030, INTERVAL, restart);
+        CHECK(!restart && slew == -(long)INTERVAL/8, "30ms behind slewed %ld, want %ld",
+              slew, -(long)INTERVAL/8);
+        CHECK(follower.lastError() == 30, "last error %ld, want 30",
+              follower.lastError());
+
+        // a frame number behind, and started a frame later: in step
+        leaderFrame(leader, follower, 100);
+        slew = follower.correction(99, 1000 - INTERVAL, INTERVAL, restart);
+        CHECK(!restart && slew == 0, "in step a frame behind slewed %ld", slew);
+
+        // more than two frames out, by frame number or by time: start over
+        leaderFrame(leader, follower, 100);
+        follower.correction(97, 1000 - 3*INTERVAL, INTERVAL, restart);
+        CHECK(restart, "3 frames behind didn't restart");
+        leaderFrame(leader, follower, 100);
+        follower.correction(100, 1000 + 3*INTERVAL, INTERVAL, restart);
+        CHECK(restart, "3 intervals late didn't restart");
+        CHECK(follower.restarts() == 2, "%u restarts, want 2",
+              (unsigned)follower.restarts());
+
+        // frame numbers wrapping around, either way
+        leaderFrame(leader, follower, 1);
+        slew = follower.correction(0xffffffff, 1000 - 2*INTERVAL + 4, INTERVAL,
+                                   restart);
+        CHECK(!restart && slew == -1, "leader past the wrap slewed %ld, want -1", slew);
+        leaderFrame(leader, follower, 0xffffffff);
+        slew = follower.correction(1, 1000 + 2*INTERVAL + 4, INTERVAL, restart);
+        CHECK(!restart && slew == -1, "follower past the wrap slewed %ld, want -1", slew);
+
+        // millis() wrapping between the leader's frame and ours
+        setMillis(ULONG_MAX - 5);
+        leaderFrame(leader, follower, 200);
+        slew = follower.correction(200, 6, INTERVAL, restart);
+        CHECK(!restart && slew == -3, "12ms behind across the wrap slewed %ld, want -3",
+              slew);
+        CHECK(follower.locked(10), "not locked across the wrap");
+        CHECK(!follower.locked(2000), "still locked after the leader went quiet");
+
+        // now the whole loop: the leader starts a frame every INTERVAL, and
+        // the follower runs its scheduler like followLeader() does,
+        // starting 17ms late, and a few frames behind by number
+        setMillis(ULONG_MAX - 1000);
+        SyncFollower f{wire};
+        StripScheduler<1> scheduler;
+        uint32_t leader_frame = 500;
+        uint32_t frame = 497;
+        unsigned long leader_start = millis();
+        long worst_slew = 0;
+        long last_error = 0;
+
+        scheduler.beginFrame(leader_start + 17, INTERVAL);
+        scheduler.nextStrip();
+
+        for (unsigned long t = 0; t < 100*INTERVAL; ++t, fakeMicros() += 1000) {
+                const unsigned long now = millis();
+
+                if (now - leader_start >= INTERVAL) {
+                        leader_start = now;
+                        leader.frameStarted({++leader_frame, 0, 0, 0, 0});
+                }
+
+                f.poll();
+                slew = f.correction(frame, scheduler.frameStart(),
+                                    scheduler.interval(), restart);
+                if (restart) {
+                        frame = f.leader().frame - 1;
+                        scheduler.restart(f.leaderMillis() - scheduler.interval());
+                } else {
+                        scheduler.slew(slew, now);
+                        if (labs(slew) > labs(worst_slew))
+                                worst_slew = slew;
+                }
+
+                if (scheduler.due(now)) {
+                        scheduler.beginFrame(now, INTERVAL);
+                        scheduler.nextStrip();
+                        ++frame;
+                }
+                if (f.packets() > 0)
+                        last_error = f.lastError();
+        }
+
+        CHECK(f.restarts() == 1, "%u restarts, want just the first",
+              (unsigned)f.restarts());
+        CHECK(labs(worst_slew) <= (long)INTERVAL/8, "slewed %ld in one go", worst_slew);
+        CHECK(labs(last_error) <= 1, "still %ld ms out after 100 frames", last_error);
+        CHECK(frame == leader_frame, "follower on frame %u, leader on %u",
+              (unsigned)frame, (unsigned)leader_frame);
+
+        return checkResult("sync_test");
+}
@@ -0,0 +1,89 @@
+// vcd_test.cpp
+//
+// The strips' pins, traced through vcd_trace.h while the two real output
+// paths drive them: DotStarOutput (the DotStar class's own bit-banging) and
+// PortOutput. Every frame each strip clocks in has to be valid APA102,
+// start and end frames included, and be the bytes that strip was shown.
+// The strips all share a port, like the board's do.
+//
+// "vcd_test strips.vcd" also writes the trace out, which is what "make vcd"
+// does; open it in GTKWave.
+
+#include <Arduino.h>
+
+#include "../LedOutput.h"
+#include "../PortOutput.h"
+
+#include "check.h"
+#include "vcd_trace.h"
+
+#include <vector>
+
+namespace {
+
+const uint8_t NR_STRIPS = 3;
+const uint16_t NR_PIXELS = 144;
+
+// strips 0-2 of the board
+const uint8_t DATA_PINS[NR_STRIPS] = {53, 51, 49};
+const uint8_t CLK_PINS[NR_STRIPS] = {52, 50, 48};
+
+}
+
+int main(int argc, char **argv)
+{
+        FILE *vcd = NULL;
+        if (argc > 1 && !(vcd = fopen(argv[1], "w"))) {
+                perror(argv[1]);
+                return 1;
+        }
+
+        Adafruit_DotStar strip{NR_PIXELS, DATA_PINS[0], CLK_PINS[0], DOTSTAR_BGR};
+        DotStarOutput dotstar_output{DATA_PINS, CLK_PINS};
+        PortOutput port_output{DATA_PINS, CLK_PINS, NR_STRIPS};
+        LedOutput *const outputs[] = {&dotstar_output, &port_output};
+
+        port_output.begin();
+
+        std::vector<uint8_t> sent[NR_STRIPS][8];
+        const uint8_t brightnesses[] = {255, 128, 0, 31};
+        randomSeed(62);
+
+        {
+                VcdTrace trace{DATA_PINS, CLK_PINS, NR_STRIPS, NR_PIXELS, vcd};
+                trace.begin();
+
+                for (uint8_t o = 0; o < 2; ++o) {
+                        for (uint8_t b = 0; b < sizeof brightnesses; ++b) {
+                                for (uint8_t s = 0; s < NR_STRIPS; ++s) {
+                                        for (uint16_t i = 0; i < 3*NR_PIXELS; ++i)
+                                                strip.getPixels()[i] = random(256);
+                                        strip.setBrightness(brightnesses[b]);
+                                        sent[s][4*o + b] = apa102Frame(strip, brightnesses[b]);
+                                        outputs[o]->show(strip, s);
+                                }
+                        }
+                }
+
+                trace.end();
+
+                for (uint8_t s = 0; s < NR_STRIPS; ++s) {
+                        const VcdTrace::Strip& t = trace.strip(s);
+                        CHECK(t.frames.size() == 8, "strip %u clocked in %zu frames, want 8",
+                              s, t.frames.size());
+                        CHECK(t.bad_frames == 0, "strip %u had %u bad frames", s,
+                              t.bad_frames);
+                        for (size_t f = 0; f < t.frames.size() && f < 8; ++f)
+                                CHECK(t.frames[f] == sent[s][f],
+                                      "strip %u frame %zu (%s) isn't what was shown",
+                                      s, f, f < 4 ? "DotStar class" : "PortOutput");
+                        CHECK(t.bits == 0, "strip %u was left %u bits into a byte",
+                              s, t.bits);
+                }
+        }
+
+        if (vcd)
+                fclose(vcd);
+
+        return checkResult("vcd_test");
+}
@@ -0,0 +1,189 @@
+// vcd_trace.h
+//
+// Follows the strips' clock and data pins on the fake ports, through
+// portWatcher(), and does two things with every edge:
+//
+// - writes it to a Value Change Dump, to look at in GTKWave. There's no
+//   clock on the computer that means anything for the board, so time in the
+//   dump is counted in port writes, one per "ns".
+//
+// - decodes what each strip would clock in, sampling data on rising clock
+//   edges like an APA102 does, and splits that into frames: a frame ends
+//   with its end frame's 0xff bytes, and a 0x00 after those is the next
+//   frame's start frame. Each frame is checked with Apa102Checker.
+//
+// Whatever drives the pins (the DotStar class's show() in
+// arduino/Adafruit_DotStar.h, or PortOutput) is traced the same way, since
+// this only sees the ports.
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "apa102_checker.h"
+
+#include <stdio.h>
+#include <vector>
+
+class VcdTrace
+{
+public:
+        struct Strip
+        {
+                uint8_t data_pin;
+                uint8_t clk_pin;
+                bool clk = false;
+                bool data = false;
+                uint8_t bits = 0;
+                uint8_t byte = 0;
+                std::vector<uint8_t> frame;
+
+                // every frame so far, and how many weren't valid APA102
+                std::vector<std::vector<uint8_t>> frames;
+                unsigned bad_frames = 0;
+        };
+
+private:
+        const uint16_t nr_leds_;
+        std::vector<Strip> strips_;
+        FILE *vcd_;
+        unsigned long time_ = 0;
+
+        static VcdTrace *&current()
+        {
+                static VcdTrace *t = NULL;
+                return t;
+        }
+
+        static bool level(const uint8_t pin)
+        {
+                return fakePorts()[digitalPinToPort(pin)] & digitalPinToBitMask(pin);
+        }
+
+        // VCD identifiers: clock then data for each strip, from '!'
+        static char id(const size_t strip, const bool data)
+        {
+                return '!' + 2*strip + data;
+        }
+
+        void endFrame(Strip& s)
+        {
+                if (s.frame.empty())
+                        return;
+
+                Apa102Checker checker{nr_leds_};
+                for (uint8_t b : s.frame)
+                        checker.add(b);
+
+                if (!checker.ok())
+                        ++s.bad_frames;
+                s.frames.push_back(s.frame);
+                s.frame.clear();
+        }
+
+        void byteIn(Strip& s, const uint8_t b)
+        {
+                // past the start frame and the LEDs, i.e. in the end frame
+                const bool in_end = s.frame.size() >= 4 + 4u*nr_leds_;
+                if (in_end && b == 0)
+                        endFrame(s);
+                s.frame.push_back(b);
+        }
+
+        void edge()
+        {
+                bool stamped = false;
+                ++time_;
+
+                for (size_t i = 0; i < strips_.size(); ++i) {
+                        Strip& s = strips_[i];
+                        const bool clk = level(s.clk_pin);
+                        const bool data = level(s.data_pin);
+
+                        if (vcd_ && (clk != s.clk || data != s.data)) {
+                                if (!stamped)
+                                        fprintf(vcd_, "#%lu\n", time_);
+                                stamped = true;
+                                if (clk != s.clk)
+                                        fprintf(vcd_, "%d%c\n", clk, id(i, false));
+                                if (data != s.data)
+                                        fprintf(vcd_, "%d%c\n", data, id(i, true));
+                        }
+
+                        if (clk && !s.clk) {
+                                s.byte = s.byte << 1 | data;
+                                if (++s.bits == 8) {
+                                        byteIn(s, s.byte);
+                                        s.bits = 0;
+                                }
+                        }
+                        s.clk = clk;
+                        s.data = data;
+                }
+        }
+
+        static void watch(const uint8_t port)
+        {
+                (void)port;
+                current()->edge();
+        }
+
+public:
+        // vcd can be NULL, to only decode
+        VcdTrace(const uint8_t *data_pins, const uint8_t *clk_pins,
+                 const uint8_t nr_strips, const uint16_t nr_leds, FILE *vcd)
+                : nr_leds_{nr_leds}, vcd_{vcd}
+        {
+                for (uint8_t i = 0; i < nr_strips; ++i) {
+                        Strip s;
+                        s.data_pin = data_pins[i];
+                        s.clk_pin = clk_pins[i];
+                        s.clk = level(s.clk_pin);
+                        s.data = level(s.data_pin);
+                        strips_.push_back(s);
+                }
+
+                if (!vcd_)
+                        return;
+
+                fprintf(vcd_, "$timescale 1ns $end\n$scope module strips $end\n");
+                for (uint8_t i = 0; i < nr_strips; ++i) {
+                        fprintf(vcd_, "$var wire 1 %c clk%u $end\n", id(i, false), i);
+                        fprintf(vcd_, "$var wire 1 %c data%u $end\n", id(i, true), i);
+                }
+                fprintf(vcd_, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+                for (uint8_t i = 0; i < nr_strips; ++i)
+                        fprintf(vcd_, "%d%c\n%d%c\n", strips_[i].clk, id(i, false),
+                                strips_[i].data, id(i, true));
+                fprintf(vcd_, "$end\n");
+        }
+
+        ~VcdTrace()
+        {
+                end();
+        }
+
+        // start following the pins
+        void begin()
+        {
+                current() = this;
+                portWatcher() = watch;
+        }
+
+        // stop, and close every strip's last frame, which has nothing after
+        // it to say it's over
+        void end()
+        {
+                if (current() != this)
+                        return;
+                portWatcher() = NULL;
+                current() = NULL;
+                for (Strip& s : strips_)
+                        endFrame(s);
+        }
+
+        const Strip& strip(const uint8_t i) const
+        {
+                return strips_[i];
+        }
+};